@@ -1,75 +1,378 @@
 #pragma once
 
+#include <cassert>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
 
+#include "simd_kernels.h"
+#include "stats.h"
+
+//        ,    
+//    .      , 
+//   : template <> struct IsTriviallyRelocatable<Handle> : std::true_type {};
+template <typename Type>
+struct IsTriviallyRelocatable : std::is_trivially_copyable<Type> {
+};
+
+template <typename Type>
+inline constexpr bool IsTriviallyRelocatableV = IsTriviallyRelocatable<Type>::value;
+
+//         Reallocate(ptr, old_size, new_size)
+template <typename Allocator, typename = void>
+struct HasReallocate : std::false_type {
+};
+
+template <typename Allocator>
+struct HasReallocate<Allocator, std::void_t<decltype(std::declval<Allocator&>().Reallocate(
+    std::declval<typename Allocator::value_type*>(), size_t{}, size_t{}))>> : std::true_type {
+};
+
+//   construct,       
+template <typename Allocator, typename = void>
+struct HasCustomConstruct : std::false_type {
+};
+
+template <typename Allocator>
+struct HasCustomConstruct<Allocator, std::void_t<decltype(std::declval<Allocator&>().construct(
+    std::declval<typename Allocator::value_type*>(), std::declval<const typename Allocator::value_type&>()))>> : std::true_type {
+};
+
 template <typename Type>
+struct HasCustomConstruct<std::allocator<Type>> : std::false_type {
+};
+
+//        AllocateZeroed(size),    mmap
+template <typename Allocator, typename = void>
+struct HasAllocateZeroed : std::false_type {
+};
+
+template <typename Allocator>
+struct HasAllocateZeroed<Allocator, std::void_t<decltype(std::declval<Allocator&>().AllocateZeroed(size_t{}))>> : std::true_type {
+};
+
+//         
+template <typename Type>
+inline constexpr bool IsZeroInitializableV = std::is_arithmetic_v<Type> || std::is_enum_v<Type> || std::is_pointer_v<Type>;
+
+//   malloc/realloc/free.       realloc
+template <typename Type>
+struct MallocAllocator {
+    static_assert(alignof(Type) <= alignof(std::max_align_t), "malloc does not support over-aligned types");
+
+    using value_type = Type;
+
+    MallocAllocator() noexcept = default;
+
+    template <typename Other>
+    MallocAllocator(const MallocAllocator<Other>&) noexcept {
+    }
+
+    Type* allocate(size_t size) {
+        if (size > SIZE_MAX / sizeof(Type)) {
+            throw std::bad_array_new_length();
+        }
+        void* raw_ptr = std::malloc(size * sizeof(Type));
+        if (!raw_ptr) {
+            throw std::bad_alloc();
+        }
+        return static_cast<Type*>(raw_ptr);
+    }
+
+    void deallocate(Type* raw_ptr, size_t) noexcept {
+        std::free(raw_ptr);
+    }
+
+    Type* Reallocate(Type* raw_ptr, size_t, size_t new_size) {
+        if (new_size > SIZE_MAX / sizeof(Type)) {
+            throw std::bad_array_new_length();
+        }
+        void* new_ptr = std::realloc(raw_ptr, new_size * sizeof(Type));
+        if (!new_ptr) {
+            throw std::bad_alloc();
+        }
+        return static_cast<Type*>(new_ptr);
+    }
+
+    template <typename Other>
+    bool operator==(const MallocAllocator<Other>&) const noexcept {
+        return true;
+    }
+
+    template <typename Other>
+    bool operator!=(const MallocAllocator<Other>&) const noexcept {
+        return false;
+    }
+};
+
+// ,      Alignment  (-,  SIMD-).
+//        Alignment,    
+//     ,      
+template <typename Type, size_t Alignment>
+struct AlignedAllocator {
+    static_assert((Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two");
+    static_assert(Alignment >= alignof(Type), "Alignment must not be weaker than alignof(Type)");
+
+    using value_type = Type;
+
+    template <typename Other>
+    struct rebind {
+        using other = AlignedAllocator<Other, Alignment>;
+    };
+
+    AlignedAllocator() noexcept = default;
+
+    template <typename Other>
+    AlignedAllocator(const AlignedAllocator<Other, Alignment>&) noexcept {
+    }
+
+    Type* allocate(size_t size) {
+        if (size > (SIZE_MAX - Alignment) / sizeof(Type)) {
+            throw std::bad_array_new_length();
+        }
+        return static_cast<Type*>(::operator new(PaddedBytes(size), std::align_val_t{ Alignment }));
+    }
+
+    void deallocate(Type* raw_ptr, size_t size) noexcept {
+        ::operator delete(raw_ptr, PaddedBytes(size), std::align_val_t{ Alignment });
+    }
+
+    template <typename Other>
+    bool operator==(const AlignedAllocator<Other, Alignment>&) const noexcept {
+        return true;
+    }
+
+    template <typename Other>
+    bool operator!=(const AlignedAllocator<Other, Alignment>&) const noexcept {
+        return false;
+    }
+
+private:
+    static size_t PaddedBytes(size_t size) noexcept {
+        return (size * sizeof(Type) + Alignment - 1) & ~(Alignment - 1);
+    }
+};
+
+//   ()   size  Type,   Allocator.
+//           -  
+//     (SimpleVector)  Construct/Destroy
+template <typename Type, typename Allocator = std::allocator<Type>>
 class ArrayPtr {
+    using AllocTraits = std::allocator_traits<Allocator>;
+
+    static_assert(std::is_same_v<typename AllocTraits::value_type, Type>,
+        "Allocator::value_type must be the same as Type");
+
 public:
 
     ArrayPtr() = default;
 
-    explicit ArrayPtr(size_t size) {
+    explicit ArrayPtr(const Allocator& alloc) noexcept
+        : impl_(alloc) {
+    }
+
+    explicit ArrayPtr(size_t size, const Allocator& alloc = Allocator())
+        : impl_(alloc) {
         if (size == 0) {
-            raw_ptr_ = nullptr;
+            impl_.raw_ptr_ = nullptr;
         }
         else {
-            raw_ptr_ = new Type[size]{};
+            impl_.raw_ptr_ = AllocTraits::allocate(impl_, size);
+            impl_.size_ = size;
+            stats::RecordAllocation<Type>(size * sizeof(Type));
         }
     }
 
-    explicit ArrayPtr(Type* raw_ptr) noexcept {
-        raw_ptr_ = raw_ptr;
+    //      size ,    alloc
+    ArrayPtr(Type* raw_ptr, size_t size, const Allocator& alloc = Allocator()) noexcept
+        : impl_(alloc) {
+        impl_.raw_ptr_ = raw_ptr;
+        impl_.size_ = size;
+    }
+
+    //    size ,    .   
+    //  ,           
+    static ArrayPtr MakeValueInitialized(size_t size, const Allocator& alloc = Allocator()) {
+        if constexpr (HasAllocateZeroed<Allocator>::value && IsZeroInitializableV<Type> && !HasCustomConstruct<Allocator>::value) {
+            ArrayPtr array(alloc);
+            if (size != 0) {
+                array.impl_.raw_ptr_ = array.impl_.AllocateZeroed(size);
+                array.impl_.size_ = size;
+                stats::RecordAllocation<Type>(size * sizeof(Type));
+            }
+            return array;
+        }
+        else {
+            ArrayPtr array(size, alloc);
+            array.UninitializedFill(array.Get(), size);
+            return array;
+        }
     }
 
     ArrayPtr(const ArrayPtr&) = delete;
 
-    ArrayPtr(ArrayPtr&& other) noexcept 
-        : raw_ptr_{std::exchange(other.raw_ptr_, nullptr)} {
+    ArrayPtr(ArrayPtr&& other) noexcept
+        : impl_(std::move(other.impl_)) {
+        other.impl_.raw_ptr_ = nullptr;
+        other.impl_.size_ = 0u;
     }
 
     ~ArrayPtr() {
-        delete[] raw_ptr_;
-        raw_ptr_ = nullptr;
+        Deallocate();
     }
 
     ArrayPtr& operator=(const ArrayPtr&) = delete;
 
+    //     ,     (propagate_on_container_move_assignment),
+    //       
     ArrayPtr& operator=(ArrayPtr&& other) noexcept {
         if (this != &other){
-            delete raw_ptr_; raw_ptr_ = nullptr;
-            std::swap(other.raw_ptr_, raw_ptr_);
+            Deallocate();
+            if constexpr (AllocTraits::propagate_on_container_move_assignment::value) {
+                static_cast<Allocator&>(impl_) = std::move(static_cast<Allocator&>(other.impl_));
+            }
+            impl_.raw_ptr_ = std::exchange(other.impl_.raw_ptr_, nullptr);
+            impl_.size_ = std::exchange(other.impl_.size_, 0u);
         }
-           // raw_ptr_ = std::exchange(other.raw_ptr_, nullptr);
         return *this;
     }
 
+    //   ,     GetAllocator()   GetSize()
     [[nodiscard]] Type* Release() noexcept {
-        Type* returned_ptr = raw_ptr_;
-        raw_ptr_ = nullptr;
-        return returned_ptr;
+        impl_.size_ = 0u;
+        return std::exchange(impl_.raw_ptr_, nullptr);
     }
 
     Type& operator[](size_t index) noexcept {
-        return raw_ptr_[index];
+        return impl_.raw_ptr_[index];
     }
 
     const Type& operator[](size_t index) const noexcept {
-        return raw_ptr_[index];
+        return impl_.raw_ptr_[index];
     }
 
     explicit operator bool() const {
-        return raw_ptr_;
+        return impl_.raw_ptr_;
     }
 
     Type* Get() const noexcept {
-        return raw_ptr_;
+        return impl_.raw_ptr_;
     }
 
+    //  ,    
+    size_t GetSize() const noexcept {
+        return impl_.size_;
+    }
+
+    const Allocator& GetAllocator() const noexcept {
+        return impl_;
+    }
+
+    //     propagate_on_container_swap,     
     void swap(ArrayPtr& other) noexcept {
-        std::swap(*this, other);
+        using std::swap;
+        if constexpr (AllocTraits::propagate_on_container_swap::value) {
+            swap(static_cast<Allocator&>(impl_), static_cast<Allocator&>(other.impl_));
+        }
+        swap(impl_.raw_ptr_, other.impl_.raw_ptr_);
+        swap(impl_.size_, other.impl_.size_);
+    }
+
+    //     new_size,   count  .
+    //    Reallocate,      
+    void Reallocate(size_t new_size, size_t count) {
+        static_assert(IsTriviallyRelocatableV<Type>, "Reallocate requires a trivially relocatable type");
+        assert(count <= impl_.size_ && count <= new_size);
+
+        if constexpr (HasReallocate<Allocator>::value) {
+            if (impl_.raw_ptr_ && new_size != 0) {
+                impl_.raw_ptr_ = impl_.Reallocate(impl_.raw_ptr_, impl_.size_, new_size);
+                impl_.size_ = new_size;
+                stats::RecordAllocation<Type>(new_size * sizeof(Type));
+                return;
+            }
+        }
+        ArrayPtr new_array(new_size, GetAllocator());
+        if (count != 0) {
+            std::memcpy(static_cast<void*>(new_array.Get()), static_cast<const void*>(impl_.raw_ptr_), count * sizeof(Type));
+        }
+        swap(new_array);
+    }
+
+    //        place   
+    template <typename... Args>
+    void Construct(Type* place, Args&&... args) {
+        AllocTraits::construct(impl_, place, std::forward<Args>(args)...);
+    }
+
+    void Destroy(Type* first, Type* last) noexcept {
+        for (; first != last; ++first) {
+            AllocTraits::destroy(impl_, first);
+        }
+    }
+
+    //   [first, last)   dest.      
+    template <typename InputIt>
+    Type* UninitializedCopy(InputIt first, InputIt last, Type* dest) {
+        Type* current = dest;
+        try {
+            for (; first != last; ++first, ++current) {
+                Construct(current, *first);
+            }
+        }
+        catch (...) {
+            Destroy(dest, current);
+            throw;
+        }
+        return current;
+    }
+
+    //  count   args   dest ( args -   )
+    template <typename... Args>
+    Type* UninitializedFill(Type* dest, size_t count, const Args&... args) {
+        if constexpr (sizeof...(Args) == 1 && (std::is_same_v<Args, Type> && ...)
+                      && std::is_trivially_copyable_v<Type> && !HasCustomConstruct<Allocator>::value) {
+            simd::Fill(dest, dest + count, args...);
+            return dest + count;
+        }
+        Type* current = dest;
+        try {
+            for (; count > 0; --count, ++current) {
+                Construct(current, args...);
+            }
+        }
+        catch (...) {
+            Destroy(dest, current);
+            throw;
+        }
+        return current;
     }
 
 private:
-    Type* raw_ptr_ = nullptr;
+    //    ,       ArrayPtr
+    struct Impl : Allocator {
+        Impl() = default;
+
+        explicit Impl(const Allocator& alloc) noexcept
+            : Allocator(alloc) {
+        }
+
+        Type* raw_ptr_ = nullptr;
+        size_t size_ = 0u;
+    };
+
+    Impl impl_;
+
+    void Deallocate() noexcept {
+        if (impl_.raw_ptr_) {
+            AllocTraits::deallocate(impl_, impl_.raw_ptr_, impl_.size_);
+        }
+        impl_.raw_ptr_ = nullptr;
+        impl_.size_ = 0u;
+    }
 };
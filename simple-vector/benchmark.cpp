@@ -0,0 +1,439 @@
+//   SimpleVector  std::vector.     :
+//     g++ -std=c++17 -O2 -DNDEBUG -pthread benchmark.cpp -o benchmark
+//     ./benchmark [--quick] [--warmup N] [--reps N] [--json report.json]
+//    warmup   ,  reps   .  
+// (  )       
+
+#include "simple_vector.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+//  ,    main.cpp
+class X {
+public:
+    X()
+        : X(5) {
+    }
+
+    X(size_t num)
+        : x_(num) {
+    }
+
+    X(const X& other) = delete;
+    X& operator=(const X& other) = delete;
+
+    X(X&& other) noexcept {
+        x_ = std::exchange(other.x_, 0);
+    }
+
+    X& operator=(X&& other) noexcept {
+        x_ = std::exchange(other.x_, 0);
+        return *this;
+    }
+
+    size_t GetX() const {
+        return x_;
+    }
+
+private:
+    size_t x_;
+};
+
+namespace {
+
+    //     ,    
+    template <typename Value>
+    void DoNotOptimize(const Value& value) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static volatile const void* sink;
+        sink = &value;
+#endif
+    }
+
+    template <typename Type>
+    Type MakeValue(size_t i) {
+        if constexpr (std::is_same_v<Type, std::string>) {
+            //   SSO,     
+            return "benchmark-value-" + std::to_string(i);
+        }
+        else {
+            return Type(i);
+        }
+    }
+
+    template <typename Type>
+    size_t Weight(const Type& value) {
+        if constexpr (std::is_same_v<Type, std::string>) {
+            return value.size();
+        }
+        else if constexpr (std::is_same_v<Type, X>) {
+            return value.GetX();
+        }
+        else {
+            return static_cast<size_t>(value);
+        }
+    }
+
+    template <typename Type>
+    const char* TypeName() {
+        if constexpr (std::is_same_v<Type, int>) {
+            return "int";
+        }
+        else if constexpr (std::is_same_v<Type, std::string>) {
+            return "string";
+        }
+        else {
+            return "X";
+        }
+    }
+
+    template <typename Type, typename = void>
+    struct IsEqualityComparable : std::false_type {
+    };
+
+    template <typename Type>
+    struct IsEqualityComparable<Type, std::void_t<decltype(std::declval<const Type&>() == std::declval<const Type&>())>> : std::true_type {
+    };
+
+    //     
+    struct SimpleVectorAdapter {
+        template <typename Type>
+        using Vector = SimpleVector<Type>;
+
+        static constexpr const char* kName = "SimpleVector";
+
+        template <typename Type, typename Value>
+        static void PushBack(Vector<Type>& vec, Value&& value) {
+            vec.PushBack(std::forward<Value>(value));
+        }
+
+        template <typename Type>
+        static void Reserve(Vector<Type>& vec, size_t capacity) {
+            vec.Reserve(capacity);
+        }
+
+        template <typename Type>
+        static void Resize(Vector<Type>& vec, size_t size) {
+            vec.Resize(size);
+        }
+
+        template <typename Type>
+        static void Insert(Vector<Type>& vec, size_t index, Type&& value) {
+            vec.Insert(vec.begin() + index, std::move(value));
+        }
+
+        template <typename Type>
+        static void Erase(Vector<Type>& vec, size_t index) {
+            vec.Erase(vec.begin() + index);
+        }
+
+        template <typename Type>
+        static size_t GetSize(const Vector<Type>& vec) {
+            return vec.GetSize();
+        }
+    };
+
+    struct StdVectorAdapter {
+        template <typename Type>
+        using Vector = std::vector<Type>;
+
+        static constexpr const char* kName = "std::vector";
+
+        template <typename Type, typename Value>
+        static void PushBack(Vector<Type>& vec, Value&& value) {
+            vec.push_back(std::forward<Value>(value));
+        }
+
+        template <typename Type>
+        static void Reserve(Vector<Type>& vec, size_t capacity) {
+            vec.reserve(capacity);
+        }
+
+        template <typename Type>
+        static void Resize(Vector<Type>& vec, size_t size) {
+            vec.resize(size);
+        }
+
+        template <typename Type>
+        static void Insert(Vector<Type>& vec, size_t index, Type&& value) {
+            vec.insert(vec.begin() + index, std::move(value));
+        }
+
+        template <typename Type>
+        static void Erase(Vector<Type>& vec, size_t index) {
+            vec.erase(vec.begin() + index);
+        }
+
+        template <typename Type>
+        static size_t GetSize(const Vector<Type>& vec) {
+            return vec.size();
+        }
+    };
+
+    struct Options {
+        size_t warmup = 2;
+        size_t reps = 15;
+        bool quick = false;
+        std::string json_path;
+    };
+
+    struct Statistics {
+        double min = 0;
+        double p50 = 0;
+        double p90 = 0;
+        double p99 = 0;
+        double mean = 0;
+    };
+
+    struct Result {
+        std::string operation;
+        std::string type;
+        size_t size = 0;
+        Statistics simple;
+        Statistics standard;
+    };
+
+    //    
+    double Percentile(const std::vector<double>& sorted, double fraction) {
+        const size_t rank = static_cast<size_t>(fraction * (sorted.size() - 1) + 0.5);
+        return sorted[std::min(rank, sorted.size() - 1)];
+    }
+
+    Statistics Summarize(std::vector<double> samples) {
+        std::sort(samples.begin(), samples.end());
+        Statistics stats;
+        stats.min = samples.front();
+        stats.p50 = Percentile(samples, 0.5);
+        stats.p90 = Percentile(samples, 0.9);
+        stats.p99 = Percentile(samples, 0.99);
+        double total = 0;
+        for (double sample : samples) {
+            total += sample;
+        }
+        stats.mean = total / samples.size();
+        return stats;
+    }
+
+    //   : setup    , run   
+    template <typename Setup, typename Run>
+    Statistics Measure(const Options& options, Setup setup, Run run) {
+        std::vector<double> samples;
+        samples.reserve(options.reps);
+        for (size_t i = 0; i < options.warmup + options.reps; ++i) {
+            auto state = setup();
+            const auto start = std::chrono::steady_clock::now();
+            run(state);
+            const auto finish = std::chrono::steady_clock::now();
+            DoNotOptimize(state);
+            if (i >= options.warmup) {
+                samples.push_back(std::chrono::duration<double, std::micro>(finish - start).count());
+            }
+        }
+        return Summarize(std::move(samples));
+    }
+
+    template <typename Adapter, typename Type>
+    typename Adapter::template Vector<Type> MakeFilled(size_t size) {
+        typename Adapter::template Vector<Type> vec;
+        Adapter::Reserve(vec, size);
+        for (size_t i = 0; i < size; ++i) {
+            Adapter::PushBack(vec, MakeValue<Type>(i));
+        }
+        return vec;
+    }
+
+    //      :     O(size),   
+    constexpr size_t kShiftOperations = 64;
+
+    //     .     
+    template <typename Adapter, typename Type>
+    std::vector<std::pair<std::string, Statistics>> RunSuite(const Options& options, size_t size) {
+        using Vector = typename Adapter::template Vector<Type>;
+        std::vector<std::pair<std::string, Statistics>> results;
+        auto empty = [] {
+            return Vector();
+        };
+        auto filled = [size] {
+            return MakeFilled<Adapter, Type>(size);
+        };
+
+        results.emplace_back("push_back", Measure(options, empty, [size](Vector& vec) {
+            for (size_t i = 0; i < size; ++i) {
+                Adapter::PushBack(vec, MakeValue<Type>(i));
+            }
+        }));
+        results.emplace_back("reserve+push_back", Measure(options, empty, [size](Vector& vec) {
+            Adapter::Reserve(vec, size);
+            for (size_t i = 0; i < size; ++i) {
+                Adapter::PushBack(vec, MakeValue<Type>(i));
+            }
+        }));
+        results.emplace_back("resize", Measure(options, empty, [size](Vector& vec) {
+            Adapter::Resize(vec, size);
+        }));
+
+        const std::pair<const char*, double> positions[] = { { "front", 0.0 }, { "middle", 0.5 }, { "back", 1.0 } };
+        for (const auto& [where, fraction] : positions) {
+            results.emplace_back(std::string("insert_") + where, Measure(options, filled, [fraction = fraction](Vector& vec) {
+                for (size_t i = 0; i < kShiftOperations; ++i) {
+                    Adapter::Insert(vec, static_cast<size_t>(Adapter::GetSize(vec) * fraction), MakeValue<Type>(i));
+                }
+            }));
+            results.emplace_back(std::string("erase_") + where, Measure(options, filled, [fraction = fraction](Vector& vec) {
+                for (size_t i = 0; i < kShiftOperations && Adapter::GetSize(vec) > 0; ++i) {
+                    const size_t index = static_cast<size_t>((Adapter::GetSize(vec) - 1) * fraction);
+                    Adapter::Erase(vec, index);
+                }
+            }));
+        }
+
+        if constexpr (std::is_copy_constructible_v<Type>) {
+            results.emplace_back("copy", Measure(options, [&filled] {
+                return std::make_pair(filled(), Vector());
+            }, [](std::pair<Vector, Vector>& state) {
+                state.second = state.first;
+            }));
+        }
+        results.emplace_back("move", Measure(options, [&filled] {
+            return std::make_pair(filled(), Vector());
+        }, [](std::pair<Vector, Vector>& state) {
+            state.second = std::move(state.first);
+        }));
+
+        results.emplace_back("iterate", Measure(options, filled, [](Vector& vec) {
+            size_t total = 0;
+            for (const Type& item : vec) {
+                total += Weight(item);
+            }
+            DoNotOptimize(total);
+        }));
+
+        if constexpr (IsEqualityComparable<Type>::value) {
+            auto pair = [&filled] {
+                return std::make_pair(filled(), filled());
+            };
+            results.emplace_back("operator==", Measure(options, pair, [](std::pair<Vector, Vector>& state) {
+                DoNotOptimize(state.first == state.second);
+            }));
+            results.emplace_back("operator<", Measure(options, pair, [](std::pair<Vector, Vector>& state) {
+                DoNotOptimize(state.first < state.second);
+            }));
+        }
+        return results;
+    }
+
+    template <typename Type>
+    void RunType(const Options& options, const std::vector<size_t>& sizes, std::vector<Result>& report) {
+        for (size_t size : sizes) {
+            auto simple = RunSuite<SimpleVectorAdapter, Type>(options, size);
+            auto standard = RunSuite<StdVectorAdapter, Type>(options, size);
+            for (size_t i = 0; i < simple.size(); ++i) {
+                report.push_back({ simple[i].first, TypeName<Type>(), size, simple[i].second, standard[i].second });
+            }
+        }
+    }
+
+    void PrintTable(const std::vector<Result>& report) {
+        std::cout << std::left << std::setw(20) << "operation" << std::setw(8) << "type" << std::right << std::setw(9) << "size"
+            << std::setw(14) << "simple p50" << std::setw(14) << "simple p90"
+            << std::setw(14) << "std p50" << std::setw(14) << "std p90" << std::setw(9) << "ratio" << '\n';
+        std::cout << std::fixed << std::setprecision(1);
+        for (const Result& result : report) {
+            std::cout << std::left << std::setw(20) << result.operation << std::setw(8) << result.type
+                << std::right << std::setw(9) << result.size
+                << std::setw(14) << result.simple.p50 << std::setw(14) << result.simple.p90
+                << std::setw(14) << result.standard.p50 << std::setw(14) << result.standard.p90
+                << std::setw(9) << std::setprecision(2) << result.simple.p50 / std::max(result.standard.p50, 1e-3)
+                << std::setprecision(1) << '\n';
+        }
+        std::cout << "(times in microseconds, ratio = SimpleVector p50 / std::vector p50)" << std::endl;
+    }
+
+    void PrintStatistics(std::ostream& out, const Statistics& stats) {
+        out << "{\"min_us\": " << stats.min << ", \"p50_us\": " << stats.p50 << ", \"p90_us\": " << stats.p90
+            << ", \"p99_us\": " << stats.p99 << ", \"mean_us\": " << stats.mean << "}";
+    }
+
+    void WriteJson(const std::string& path, const Options& options, const std::vector<Result>& report) {
+        std::ofstream out(path);
+        if (!out) {
+            throw std::runtime_error("Cannot open " + path);
+        }
+        out << std::fixed << std::setprecision(3);
+        out << "{\n  \"warmup\": " << options.warmup << ",\n  \"repetitions\": " << options.reps << ",\n  \"results\": [\n";
+        for (size_t i = 0; i < report.size(); ++i) {
+            const Result& result = report[i];
+            out << "    {\"operation\": \"" << result.operation << "\", \"type\": \"" << result.type
+                << "\", \"size\": " << result.size << ", \"SimpleVector\": ";
+            PrintStatistics(out, result.simple);
+            out << ", \"std::vector\": ";
+            PrintStatistics(out, result.standard);
+            out << (i + 1 < report.size() ? "},\n" : "}\n");
+        }
+        out << "  ]\n}\n";
+    }
+
+    Options ParseOptions(int argc, char* argv[]) {
+        Options options;
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg = argv[i];
+            if (arg == "--quick") {
+                options.quick = true;
+                options.warmup = 1;
+                options.reps = 3;
+            }
+            else if (arg == "--warmup" && i + 1 < argc) {
+                options.warmup = std::strtoul(argv[++i], nullptr, 10);
+            }
+            else if (arg == "--reps" && i + 1 < argc) {
+                options.reps = std::max(1ul, std::strtoul(argv[++i], nullptr, 10));
+            }
+            else if (arg == "--json" && i + 1 < argc) {
+                options.json_path = argv[++i];
+            }
+            else {
+                throw std::invalid_argument("Unknown argument: " + arg);
+            }
+        }
+        return options;
+    }
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    try {
+        const Options options = ParseOptions(argc, argv);
+        const std::vector<size_t> sizes = options.quick ? std::vector<size_t>{ 1000, 10000 } : std::vector<size_t>{ 1000, 100000, 1000000 };
+        //    ,       
+        const std::vector<size_t> string_sizes(sizes.begin(), sizes.end() - (sizes.size() > 2 ? 1 : 0));
+
+        std::vector<Result> report;
+        RunType<int>(options, sizes, report);
+        RunType<std::string>(options, string_sizes, report);
+        RunType<X>(options, sizes, report);
+
+        PrintTable(report);
+        if (!options.json_path.empty()) {
+            WriteJson(options.json_path, options, report);
+            std::cout << "JSON report: " << options.json_path << std::endl;
+        }
+    }
+    catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
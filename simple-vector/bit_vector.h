@@ -0,0 +1,479 @@
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+#include "simple_vector.h"
+
+namespace bit_detail {
+
+    using Word = uint64_t;
+
+    inline constexpr size_t kWordBits = 64;
+
+    inline constexpr size_t WordCount(size_t bits) noexcept {
+        return (bits + kWordBits - 1) / kWordBits;
+    }
+
+    inline constexpr Word Mask(size_t index) noexcept {
+        return Word{ 1 } << (index % kWordBits);
+    }
+
+    inline unsigned PopCount(Word word) noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+        // __popcnt64  POPCNT,      
+        word = word - ((word >> 1) & 0x5555555555555555ull);
+        word = (word & 0x3333333333333333ull) + ((word >> 2) & 0x3333333333333333ull);
+        return static_cast<unsigned>((((word + (word >> 4)) & 0x0F0F0F0F0F0F0F0Full) * 0x0101010101010101ull) >> 56);
+#else
+        return static_cast<unsigned>(__builtin_popcountll(word));
+#endif
+    }
+
+    // word != 0
+    inline unsigned CountTrailingZeros(Word word) noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+        unsigned long index;
+        _BitScanForward64(&index, word);
+        return index;
+#else
+        return static_cast<unsigned>(__builtin_ctzll(word));
+#endif
+    }
+
+} // namespace bit_detail
+
+//   :       uint64_t  SimpleVector.
+//  PushBack/Resize/operator[]/ SimpleVector,  operator[]  
+//  - Reference. Count, FindFirst/FindNext  And/Or/Xor/Not 
+//  .        
+class BitVector {
+    using Word = bit_detail::Word;
+    using Words = SimpleVector<Word>;
+
+    template <bool IsConst>
+    class BasicIterator;
+
+public:
+    // -   ; ,     
+    class Reference {
+    public:
+        Reference& operator=(bool value) noexcept {
+            if (value) {
+                *word_ |= mask_;
+            }
+            else {
+                *word_ &= ~mask_;
+            }
+            return *this;
+        }
+
+        Reference& operator=(const Reference& other) noexcept {
+            return *this = static_cast<bool>(other);
+        }
+
+        operator bool() const noexcept {
+            return (*word_ & mask_) != 0;
+        }
+
+        bool operator~() const noexcept {
+            return !static_cast<bool>(*this);
+        }
+
+        Reference& Flip() noexcept {
+            *word_ ^= mask_;
+            return *this;
+        }
+
+    private:
+        friend class BitVector;
+
+        Reference(Word* word, Word mask) noexcept
+            : word_(word), mask_(mask) {
+        }
+
+        Word* word_;
+        Word mask_;
+    };
+
+    using Iterator = BasicIterator<false>;
+    using ConstIterator = BasicIterator<true>;
+
+    BitVector() noexcept = default;
+
+    explicit BitVector(size_t size, bool value = false) {
+        Resize(size, value);
+    }
+
+    BitVector(std::initializer_list<bool> init) {
+        Reserve(init.size());
+        for (bool value : init) {
+            PushBack(value);
+        }
+    }
+
+    BitVector(ReserveProxyObj obj) {
+        Reserve(obj.GetVoid());
+    }
+
+    size_t GetSize() const noexcept {
+        return size_;
+    }
+
+    //   
+    size_t GetCapacity() const noexcept {
+        return words_.GetCapacity() * bit_detail::kWordBits;
+    }
+
+    bool IsEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    //      ,    - 
+    const Words& GetWords() const noexcept {
+        return words_;
+    }
+
+    bool operator[](size_t index) const noexcept {
+        assert(index < size_);
+        return (words_[index / bit_detail::kWordBits] & bit_detail::Mask(index)) != 0;
+    }
+
+    Reference operator[](size_t index) noexcept {
+        assert(index < size_);
+        return Reference(&words_[index / bit_detail::kWordBits], bit_detail::Mask(index));
+    }
+
+    bool At(size_t index) const {
+        if (index >= size_) {
+            throw std::out_of_range("Index is Out of Range");
+        }
+        return (*this)[index];
+    }
+
+    Reference At(size_t index) {
+        if (index >= size_) {
+            throw std::out_of_range("Index is Out of Range");
+        }
+        return (*this)[index];
+    }
+
+    Iterator begin() noexcept {
+        return Iterator(words_.Data(), 0);
+    }
+
+    Iterator end() noexcept {
+        return Iterator(words_.Data(), size_);
+    }
+
+    ConstIterator begin() const noexcept {
+        return ConstIterator(words_.Data(), 0);
+    }
+
+    ConstIterator end() const noexcept {
+        return ConstIterator(words_.Data(), size_);
+    }
+
+    ConstIterator cbegin() const noexcept {
+        return begin();
+    }
+
+    ConstIterator cend() const noexcept {
+        return end();
+    }
+
+    void PushBack(bool value) {
+        if (size_ % bit_detail::kWordBits == 0) {
+            words_.PushBack(0);
+        }
+        ++size_;
+        (*this)[size_ - 1] = value;
+    }
+
+    void PopBack() noexcept {
+        assert(size_ > 0);
+        --size_;
+        words_[size_ / bit_detail::kWordBits] &= ~bit_detail::Mask(size_);
+        if (size_ % bit_detail::kWordBits == 0) {
+            words_.PopBack();
+        }
+    }
+
+    //     value;   ,     Count
+    void Resize(size_t new_size, bool value = false) {
+        const size_t old_size = size_;
+        words_.Resize(bit_detail::WordCount(new_size));
+        if (new_size > old_size && value) {
+            //     ,   
+            size_t index = old_size / bit_detail::kWordBits;
+            if (old_size % bit_detail::kWordBits != 0) {
+                words_[index++] |= ~(bit_detail::Mask(old_size) - 1);
+            }
+            for (; index < words_.GetSize(); ++index) {
+                words_[index] = ~Word{ 0 };
+            }
+        }
+        size_ = new_size;
+        ClearTail();
+    }
+
+    void Reserve(size_t new_capacity) {
+        words_.Reserve(bit_detail::WordCount(new_capacity));
+    }
+
+    void Clear() noexcept {
+        words_.Clear();
+        size_ = 0;
+    }
+
+    //   
+    size_t Count() const noexcept {
+        size_t count = 0;
+        for (Word word : words_) {
+            count += bit_detail::PopCount(word);
+        }
+        return count;
+    }
+
+    bool Any() const noexcept {
+        for (Word word : words_) {
+            if (word != 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool None() const noexcept {
+        return !Any();
+    }
+
+    bool All() const noexcept {
+        return Count() == size_;
+    }
+
+    //      GetSize(),   
+    size_t FindFirst() const noexcept {
+        return FindFrom(0);
+    }
+
+    //      pos  GetSize()
+    size_t FindNext(size_t pos) const noexcept {
+        return pos + 1 >= size_ ? size_ : FindFrom(pos + 1);
+    }
+
+    //       
+    BitVector& And(const BitVector& other) noexcept {
+        assert(size_ == other.size_);
+        for (size_t i = 0; i < words_.GetSize(); ++i) {
+            words_[i] &= other.words_[i];
+        }
+        return *this;
+    }
+
+    BitVector& Or(const BitVector& other) noexcept {
+        assert(size_ == other.size_);
+        for (size_t i = 0; i < words_.GetSize(); ++i) {
+            words_[i] |= other.words_[i];
+        }
+        return *this;
+    }
+
+    BitVector& Xor(const BitVector& other) noexcept {
+        assert(size_ == other.size_);
+        for (size_t i = 0; i < words_.GetSize(); ++i) {
+            words_[i] ^= other.words_[i];
+        }
+        return *this;
+    }
+
+    BitVector& Not() noexcept {
+        for (Word& word : words_) {
+            word = ~word;
+        }
+        ClearTail();
+        return *this;
+    }
+
+    BitVector& operator&=(const BitVector& other) noexcept {
+        return And(other);
+    }
+
+    BitVector& operator|=(const BitVector& other) noexcept {
+        return Or(other);
+    }
+
+    BitVector& operator^=(const BitVector& other) noexcept {
+        return Xor(other);
+    }
+
+    void swap(BitVector& other) noexcept {
+        words_.swap(other.words_);
+        std::swap(size_, other.size_);
+    }
+
+private:
+    Words words_;
+    size_t size_ = 0;
+
+    //       
+    void ClearTail() noexcept {
+        if (size_ % bit_detail::kWordBits != 0) {
+            words_[words_.GetSize() - 1] &= bit_detail::Mask(size_) - 1;
+        }
+    }
+
+    size_t FindFrom(size_t pos) const noexcept {
+        size_t index = pos / bit_detail::kWordBits;
+        if (index >= words_.GetSize()) {
+            return size_;
+        }
+        Word word = words_[index] & ~(bit_detail::Mask(pos) - 1);
+        while (word == 0) {
+            if (++index == words_.GetSize()) {
+                return size_;
+            }
+            word = words_[index];
+        }
+        return index * bit_detail::kWordBits + bit_detail::CountTrailingZeros(word);
+    }
+
+    //   :    Reference,  -  bool
+    template <bool IsConst>
+    class BasicIterator {
+        using WordPtr = std::conditional_t<IsConst, const Word*, Word*>;
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = bool;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::conditional_t<IsConst, bool, Reference>;
+        using pointer = void;
+
+        BasicIterator() = default;
+
+        //      
+        template <bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+        BasicIterator(const BasicIterator<OtherConst>& other) noexcept
+            : words_(other.words_), index_(other.index_) {
+        }
+
+        reference operator*() const noexcept {
+            if constexpr (IsConst) {
+                return (words_[index_ / bit_detail::kWordBits] & bit_detail::Mask(index_)) != 0;
+            }
+            else {
+                return Reference(words_ + index_ / bit_detail::kWordBits, bit_detail::Mask(index_));
+            }
+        }
+
+        reference operator[](difference_type offset) const noexcept {
+            return *(*this + offset);
+        }
+
+        BasicIterator& operator++() noexcept {
+            ++index_;
+            return *this;
+        }
+
+        BasicIterator operator++(int) noexcept {
+            BasicIterator old = *this;
+            ++index_;
+            return old;
+        }
+
+        BasicIterator& operator--() noexcept {
+            --index_;
+            return *this;
+        }
+
+        BasicIterator operator--(int) noexcept {
+            BasicIterator old = *this;
+            --index_;
+            return old;
+        }
+
+        BasicIterator& operator+=(difference_type offset) noexcept {
+            index_ += offset;
+            return *this;
+        }
+
+        BasicIterator& operator-=(difference_type offset) noexcept {
+            index_ -= offset;
+            return *this;
+        }
+
+        friend BasicIterator operator+(BasicIterator it, difference_type offset) noexcept {
+            return it += offset;
+        }
+
+        friend BasicIterator operator+(difference_type offset, BasicIterator it) noexcept {
+            return it += offset;
+        }
+
+        friend BasicIterator operator-(BasicIterator it, difference_type offset) noexcept {
+            return it -= offset;
+        }
+
+        friend difference_type operator-(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return static_cast<difference_type>(lhs.index_) - static_cast<difference_type>(rhs.index_);
+        }
+
+        friend bool operator==(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return lhs.index_ == rhs.index_;
+        }
+
+        friend bool operator!=(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return lhs.index_ != rhs.index_;
+        }
+
+        friend bool operator<(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return lhs.index_ < rhs.index_;
+        }
+
+        friend bool operator>(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return rhs < lhs;
+        }
+
+        friend bool operator<=(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return !(rhs < lhs);
+        }
+
+        friend bool operator>=(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return !(lhs < rhs);
+        }
+
+    private:
+        friend class BitVector;
+        friend class BasicIterator<!IsConst>;
+
+        BasicIterator(WordPtr words, size_t index) noexcept
+            : words_(words), index_(index) {
+        }
+
+        WordPtr words_ = nullptr;
+        size_t index_ = 0;
+    };
+};
+
+inline void swap(BitVector& lhs, BitVector& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+//    ,       
+inline bool operator==(const BitVector& lhs, const BitVector& rhs) {
+    return lhs.GetSize() == rhs.GetSize() && lhs.GetWords() == rhs.GetWords();
+}
+
+inline bool operator!=(const BitVector& lhs, const BitVector& rhs) {
+    return !(lhs == rhs);
+}
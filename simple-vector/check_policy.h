@@ -0,0 +1,236 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <iterator>
+#include <type_traits>
+
+#if defined(__GNUC__) || defined(__clang__)
+#define SIMPLE_VECTOR_UNLIKELY(condition) __builtin_expect(!!(condition), 0)
+#define SIMPLE_VECTOR_TRAP() __builtin_trap()
+#elif defined(_MSC_VER)
+#include <intrin.h>
+#define SIMPLE_VECTOR_UNLIKELY(condition) (condition)
+#define SIMPLE_VECTOR_TRAP() __fastfail(7)
+#else
+#define SIMPLE_VECTOR_UNLIKELY(condition) (condition)
+#define SIMPLE_VECTOR_TRAP() std::abort()
+#endif
+
+//   SimpleVector. Check(condition, message)   operator[], PopBack,
+//  Insert/Erase  .. (At   std::out_of_range). kCheckedIterators  ,
+//      
+
+//   -   ,    
+struct UncheckedPolicy {
+    static constexpr bool kCheckedIterators = false;
+
+    static void Check(bool, const char*) noexcept {
+    }
+};
+
+//   assert:        NDEBUG.   
+struct AssertPolicy {
+    static constexpr bool kCheckedIterators = false;
+
+    static void Check([[maybe_unused]] bool condition, [[maybe_unused]] const char* message) noexcept {
+        assert(condition && message);
+    }
+};
+
+//    :        
+//   ,       
+struct HardenedPolicy {
+    static constexpr bool kCheckedIterators = false;
+
+    static void Check(bool condition, const char*) noexcept {
+        if (SIMPLE_VECTOR_UNLIKELY(!condition)) {
+            SIMPLE_VECTOR_TRAP();
+        }
+    }
+};
+
+// :           
+struct DebugPolicy {
+    static constexpr bool kCheckedIterators = true;
+
+    static void Check(bool condition, const char* message) noexcept {
+        if (!condition) {
+            std::fprintf(stderr, "SimpleVector check failed: %s\n", message);
+            std::abort();
+        }
+    }
+};
+
+namespace check_detail {
+
+    //   :    .
+    //          
+    template <bool Enabled>
+    class Generation {
+    protected:
+        void Invalidate() noexcept {
+        }
+    };
+
+    template <>
+    class Generation<true> {
+    public:
+        size_t GetGeneration() const noexcept {
+            return generation_;
+        }
+
+    protected:
+        void Invalidate() noexcept {
+            ++generation_;
+        }
+
+    private:
+        size_t generation_ = 0;
+    };
+
+} // namespace check_detail
+
+// ,      .  , 
+//      [begin, end),    Policy::Check
+template <typename Container, typename Value, typename Policy>
+class CheckedIterator {
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::remove_const_t<Value>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Value*;
+    using reference = Value&;
+
+    CheckedIterator() = default;
+
+    CheckedIterator(const Container* owner, Value* ptr) noexcept
+        : owner_(owner), generation_(owner->GetGeneration()), ptr_(ptr) {
+    }
+
+    //      
+    template <typename Other, typename = std::enable_if_t<std::is_same_v<const Other, Value> && !std::is_same_v<Other, Value>>>
+    CheckedIterator(const CheckedIterator<Container, Other, Policy>& other) noexcept
+        : owner_(other.owner_), generation_(other.generation_), ptr_(other.ptr_) {
+    }
+
+    reference operator*() const noexcept {
+        CheckDereferenceable();
+        return *ptr_;
+    }
+
+    pointer operator->() const noexcept {
+        CheckDereferenceable();
+        return ptr_;
+    }
+
+    reference operator[](difference_type offset) const noexcept {
+        return *(*this + offset);
+    }
+
+    //     ,       [begin, end]
+    Value* Get() const noexcept {
+        CheckValid();
+        Policy::Check(ptr_ >= owner_->Data() && ptr_ <= owner_->Data() + owner_->GetSize(), "iterator is out of range");
+        return ptr_;
+    }
+
+    CheckedIterator& operator++() noexcept {
+        ++ptr_;
+        return *this;
+    }
+
+    CheckedIterator operator++(int) noexcept {
+        CheckedIterator old = *this;
+        ++ptr_;
+        return old;
+    }
+
+    CheckedIterator& operator--() noexcept {
+        --ptr_;
+        return *this;
+    }
+
+    CheckedIterator operator--(int) noexcept {
+        CheckedIterator old = *this;
+        --ptr_;
+        return old;
+    }
+
+    CheckedIterator& operator+=(difference_type offset) noexcept {
+        ptr_ += offset;
+        return *this;
+    }
+
+    CheckedIterator& operator-=(difference_type offset) noexcept {
+        ptr_ -= offset;
+        return *this;
+    }
+
+    friend CheckedIterator operator+(CheckedIterator it, difference_type offset) noexcept {
+        return it += offset;
+    }
+
+    friend CheckedIterator operator+(difference_type offset, CheckedIterator it) noexcept {
+        return it += offset;
+    }
+
+    friend CheckedIterator operator-(CheckedIterator it, difference_type offset) noexcept {
+        return it -= offset;
+    }
+
+    friend difference_type operator-(const CheckedIterator& lhs, const CheckedIterator& rhs) noexcept {
+        lhs.CheckComparable(rhs);
+        return lhs.ptr_ - rhs.ptr_;
+    }
+
+    friend bool operator==(const CheckedIterator& lhs, const CheckedIterator& rhs) noexcept {
+        lhs.CheckComparable(rhs);
+        return lhs.ptr_ == rhs.ptr_;
+    }
+
+    friend bool operator!=(const CheckedIterator& lhs, const CheckedIterator& rhs) noexcept {
+        return !(lhs == rhs);
+    }
+
+    friend bool operator<(const CheckedIterator& lhs, const CheckedIterator& rhs) noexcept {
+        lhs.CheckComparable(rhs);
+        return lhs.ptr_ < rhs.ptr_;
+    }
+
+    friend bool operator>(const CheckedIterator& lhs, const CheckedIterator& rhs) noexcept {
+        return rhs < lhs;
+    }
+
+    friend bool operator<=(const CheckedIterator& lhs, const CheckedIterator& rhs) noexcept {
+        return !(rhs < lhs);
+    }
+
+    friend bool operator>=(const CheckedIterator& lhs, const CheckedIterator& rhs) noexcept {
+        return !(lhs < rhs);
+    }
+
+private:
+    template <typename, typename, typename>
+    friend class CheckedIterator;
+
+    const Container* owner_ = nullptr;
+    size_t generation_ = 0;
+    Value* ptr_ = nullptr;
+
+    void CheckValid() const noexcept {
+        Policy::Check(owner_ != nullptr, "iterator is not bound to a vector");
+        Policy::Check(owner_->GetGeneration() == generation_, "iterator was invalidated by reallocation");
+    }
+
+    void CheckDereferenceable() const noexcept {
+        CheckValid();
+        Policy::Check(ptr_ >= owner_->Data() && ptr_ < owner_->Data() + owner_->GetSize(), "iterator is not dereferenceable");
+    }
+
+    void CheckComparable(const CheckedIterator& other) const noexcept {
+        Policy::Check(owner_ == other.owner_, "iterators belong to different vectors");
+    }
+};
@@ -0,0 +1,360 @@
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+#include "array_ptr.h"
+
+namespace concurrent_detail {
+
+    constexpr size_t FloorLog2(size_t value) noexcept {
+        size_t result = 0;
+        while (value >>= 1) {
+            ++result;
+        }
+        return result;
+    }
+
+} // namespace concurrent_detail
+
+//          .
+//       (FirstSegmentSize, 2 * FirstSegmentSize, ...),
+//    ,    .   
+//          . GetSize()   ,
+//     ,       GetSize()    .
+//    ,        , 
+//      .     .
+// Clear, Reserve          
+template <typename Type, size_t FirstSegmentSize = 32, typename Allocator = std::allocator<Type>>
+class ConcurrentSimpleVector {
+    static_assert(FirstSegmentSize > 0 && (FirstSegmentSize & (FirstSegmentSize - 1)) == 0,
+        "FirstSegmentSize must be a power of two");
+    static_assert(std::is_nothrow_move_constructible_v<Type>, "ConcurrentSimpleVector requires a nothrow move constructible type");
+
+public:
+    class ConstIterator;
+
+    ConcurrentSimpleVector() noexcept(noexcept(Allocator())) = default;
+
+    explicit ConcurrentSimpleVector(const Allocator& alloc) noexcept :
+        alloc_(alloc) {
+    }
+
+    ConcurrentSimpleVector(const ConcurrentSimpleVector&) = delete;
+    ConcurrentSimpleVector& operator=(const ConcurrentSimpleVector&) = delete;
+
+    ~ConcurrentSimpleVector() {
+        Clear();
+        for (std::atomic<Segment*>& segment : segments_) {
+            delete segment.load(std::memory_order_relaxed);
+        }
+    }
+
+    //     
+    size_t GetSize() const noexcept {
+        return published_.load(std::memory_order_acquire);
+    }
+
+    bool IsEmpty() const noexcept {
+        return GetSize() == 0;
+    }
+
+    //  ,     
+    size_t GetCapacity() const noexcept {
+        size_t capacity = 0;
+        for (size_t segment = 0; segment < kMaxSegments && segments_[segment].load(std::memory_order_acquire); ++segment) {
+            capacity += SegmentSize(segment);
+        }
+        return capacity;
+    }
+
+    Type& operator[](size_t index) noexcept {
+        assert(index < GetSize());
+        return *SlotPtr(index);
+    }
+
+    const Type& operator[](size_t index) const noexcept {
+        assert(index < GetSize());
+        return *SlotPtr(index);
+    }
+
+    Type& At(size_t index) {
+        CheckIndex(index);
+        return *SlotPtr(index);
+    }
+
+    const Type& At(size_t index) const {
+        CheckIndex(index);
+        return *SlotPtr(index);
+    }
+
+    //  Push_Back.    
+    size_t PushBack(const Type& item) {
+        return EmplaceBack(item);
+    }
+
+    //  Push_Back
+    size_t PushBack(Type&& item) {
+        return EmplaceBack(std::move(item));
+    }
+
+    //     . ,    , 
+    //      ,       
+    template <typename... Args>
+    size_t EmplaceBack(Args&&... args) {
+        if constexpr (std::is_nothrow_constructible_v<Type, Args&&...>) {
+            return EmplaceReserved(std::forward<Args>(args)...);
+        }
+        else {
+            Type item(std::forward<Args>(args)...);
+            return EmplaceReserved(std::move(item));
+        }
+    }
+
+    //     capacity 
+    void Reserve(size_t capacity) {
+        for (size_t segment = 0; segment < kMaxSegments && SegmentBegin(segment) < capacity; ++segment) {
+            GetOrCreateSegment(segment);
+        }
+    }
+
+    //  ,   
+    void Clear() noexcept {
+        const size_t size = reserved_.load(std::memory_order_acquire);
+        for (size_t index = 0; index < size; ++index) {
+            const auto [segment, offset] = Locate(index);
+            Segment& storage = *segments_[segment].load(std::memory_order_relaxed);
+            std::allocator_traits<Allocator>::destroy(alloc_, storage.items.Get() + offset);
+            storage.states[offset].store(kEmpty, std::memory_order_relaxed);
+        }
+        reserved_.store(0, std::memory_order_relaxed);
+        published_.store(0, std::memory_order_release);
+    }
+
+    ConstIterator begin() const noexcept {
+        return ConstIterator(this, 0);
+    }
+
+    //         end()
+    ConstIterator end() const noexcept {
+        return ConstIterator(this, GetSize());
+    }
+
+    class ConstIterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Type*;
+        using reference = const Type&;
+
+        ConstIterator() = default;
+
+        reference operator*() const noexcept {
+            return *vector_->SlotPtr(index_);
+        }
+
+        pointer operator->() const noexcept {
+            return vector_->SlotPtr(index_);
+        }
+
+        reference operator[](difference_type offset) const noexcept {
+            return *vector_->SlotPtr(index_ + offset);
+        }
+
+        ConstIterator& operator++() noexcept {
+            ++index_;
+            return *this;
+        }
+
+        ConstIterator operator++(int) noexcept {
+            ConstIterator old = *this;
+            ++index_;
+            return old;
+        }
+
+        ConstIterator& operator--() noexcept {
+            --index_;
+            return *this;
+        }
+
+        ConstIterator operator--(int) noexcept {
+            ConstIterator old = *this;
+            --index_;
+            return old;
+        }
+
+        ConstIterator& operator+=(difference_type offset) noexcept {
+            index_ += offset;
+            return *this;
+        }
+
+        ConstIterator& operator-=(difference_type offset) noexcept {
+            index_ -= offset;
+            return *this;
+        }
+
+        friend ConstIterator operator+(ConstIterator it, difference_type offset) noexcept {
+            return it += offset;
+        }
+
+        friend ConstIterator operator+(difference_type offset, ConstIterator it) noexcept {
+            return it += offset;
+        }
+
+        friend ConstIterator operator-(ConstIterator it, difference_type offset) noexcept {
+            return it -= offset;
+        }
+
+        friend difference_type operator-(const ConstIterator& lhs, const ConstIterator& rhs) noexcept {
+            return static_cast<difference_type>(lhs.index_) - static_cast<difference_type>(rhs.index_);
+        }
+
+        friend bool operator==(const ConstIterator& lhs, const ConstIterator& rhs) noexcept {
+            return lhs.index_ == rhs.index_;
+        }
+
+        friend bool operator!=(const ConstIterator& lhs, const ConstIterator& rhs) noexcept {
+            return lhs.index_ != rhs.index_;
+        }
+
+        friend bool operator<(const ConstIterator& lhs, const ConstIterator& rhs) noexcept {
+            return lhs.index_ < rhs.index_;
+        }
+
+        friend bool operator>(const ConstIterator& lhs, const ConstIterator& rhs) noexcept {
+            return rhs < lhs;
+        }
+
+        friend bool operator<=(const ConstIterator& lhs, const ConstIterator& rhs) noexcept {
+            return !(rhs < lhs);
+        }
+
+        friend bool operator>=(const ConstIterator& lhs, const ConstIterator& rhs) noexcept {
+            return !(lhs < rhs);
+        }
+
+    private:
+        friend class ConcurrentSimpleVector;
+
+        ConstIterator(const ConcurrentSimpleVector* vector, size_t index) noexcept
+            : vector_(vector), index_(index) {
+        }
+
+        const ConcurrentSimpleVector* vector_ = nullptr;
+        size_t index_ = 0;
+    };
+
+private:
+    static constexpr unsigned char kEmpty = 0;
+    static constexpr unsigned char kReady = 1;
+
+    //     ,   size_t
+    static constexpr size_t kMaxSegments = sizeof(size_t) * 8 - concurrent_detail::FloorLog2(FirstSegmentSize);
+
+    struct Segment {
+        Segment(size_t size, const Allocator& alloc)
+            : items(size, alloc), states(new std::atomic<unsigned char>[size]) {
+            for (size_t i = 0; i < size; ++i) {
+                states[i].store(kEmpty, std::memory_order_relaxed);
+            }
+        }
+
+        ArrayPtr<Type, Allocator> items;
+        std::unique_ptr<std::atomic<unsigned char>[]> states;
+    };
+
+    Allocator alloc_;
+    std::atomic<Segment*> segments_[kMaxSegments] = {};
+
+    //   
+    std::atomic<size_t> reserved_{ 0 };
+    //  ,      
+    std::atomic<size_t> published_{ 0 };
+
+    static constexpr size_t SegmentSize(size_t segment) noexcept {
+        return FirstSegmentSize << segment;
+    }
+
+    static constexpr size_t SegmentBegin(size_t segment) noexcept {
+        return FirstSegmentSize * ((size_t{ 1 } << segment) - 1);
+    }
+
+    //        :  s   FirstSegmentSize * (2^s - 1)
+    static std::pair<size_t, size_t> Locate(size_t index) noexcept {
+        const size_t shifted = index + FirstSegmentSize;
+        size_t log2;
+#if defined(_MSC_VER) && !defined(__clang__)
+        unsigned long bit;
+        _BitScanReverse64(&bit, shifted);
+        log2 = bit;
+#else
+        log2 = sizeof(unsigned long long) * 8 - 1 - __builtin_clzll(shifted);
+#endif
+        const size_t segment = log2 - concurrent_detail::FloorLog2(FirstSegmentSize);
+        return { segment, shifted - (size_t{ 1 } << log2) };
+    }
+
+    Type* SlotPtr(size_t index) const noexcept {
+        const auto [segment, offset] = Locate(index);
+        return segments_[segment].load(std::memory_order_acquire)->items.Get() + offset;
+    }
+
+    void CheckIndex(size_t index) const {
+        if (index >= GetSize()) {
+            throw std::out_of_range("Index is Out of Range");
+        }
+    }
+
+    //        ,    .
+    //      :    ,   
+    template <typename... Args>
+    size_t EmplaceReserved(Args&&... args) {
+        size_t index = reserved_.load(std::memory_order_relaxed);
+        Segment* storage = nullptr;
+        do {
+            storage = &GetOrCreateSegment(Locate(index).first);
+        } while (!reserved_.compare_exchange_weak(index, index + 1, std::memory_order_relaxed));
+        const size_t offset = Locate(index).second;
+        std::allocator_traits<Allocator>::construct(alloc_, storage->items.Get() + offset, std::forward<Args>(args)...);
+        storage->states[offset].store(kReady);
+        Publish();
+        return index;
+    }
+
+    //       ,     
+    Segment& GetOrCreateSegment(size_t segment) {
+        Segment* existing = segments_[segment].load(std::memory_order_acquire);
+        if (existing) {
+            return *existing;
+        }
+        auto created = std::make_unique<Segment>(SegmentSize(segment), alloc_);
+        if (segments_[segment].compare_exchange_strong(existing, created.get(), std::memory_order_acq_rel)) {
+            return *created.release();
+        }
+        return *existing;
+    }
+
+    //       . Ÿ   ,
+    //  ,          
+    void Publish() noexcept {
+        size_t published = published_.load();
+        while (published < reserved_.load()) {
+            const auto [segment, offset] = Locate(published);
+            Segment* storage = segments_[segment].load(std::memory_order_acquire);
+            if (!storage || storage->states[offset].load() == kEmpty) {
+                return;
+            }
+            published_.compare_exchange_weak(published, published + 1);
+        }
+    }
+};
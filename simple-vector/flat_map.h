@@ -0,0 +1,402 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "flat_set.h"
+#include "simple_vector.h"
+
+//     SimpleVector:       ,
+//       .     
+// std::pair<const Key&, Value&>,    .
+//      -   FlatSet
+template <typename Key, typename Value, typename Compare = std::less<Key>, typename Layout = SortedLayout>
+class FlatMap {
+    using Keys = SimpleVector<Key>;
+    using Values = SimpleVector<Value>;
+
+    template <bool IsConst>
+    class BasicIterator;
+
+public:
+    using Reference = std::pair<const Key&, Value&>;
+    using ConstReference = std::pair<const Key&, const Value&>;
+
+    using Iterator = BasicIterator<false>;
+    using ConstIterator = BasicIterator<true>;
+
+    FlatMap() = default;
+
+    explicit FlatMap(const Compare& comp) :
+        comp_(comp) {
+    }
+
+    FlatMap(std::initializer_list<std::pair<Key, Value>> init, const Compare& comp = Compare()) :
+        comp_(comp) {
+        InsertBatch(init.begin(), init.end());
+    }
+
+    size_t GetSize() const noexcept {
+        return keys_.GetSize();
+    }
+
+    bool IsEmpty() const noexcept {
+        return keys_.IsEmpty();
+    }
+
+    const Keys& GetKeys() const noexcept {
+        return keys_;
+    }
+
+    const Values& GetValues() const noexcept {
+        return values_;
+    }
+
+    Iterator begin() noexcept {
+        return Iterator(this, 0);
+    }
+
+    Iterator end() noexcept {
+        return Iterator(this, GetSize());
+    }
+
+    ConstIterator begin() const noexcept {
+        return ConstIterator(this, 0);
+    }
+
+    ConstIterator end() const noexcept {
+        return ConstIterator(this, GetSize());
+    }
+
+    ConstIterator cbegin() const noexcept {
+        return begin();
+    }
+
+    ConstIterator cend() const noexcept {
+        return end();
+    }
+
+    Iterator Find(const Key& key) {
+        return Iterator(this, FindIndex(key));
+    }
+
+    ConstIterator Find(const Key& key) const {
+        return ConstIterator(this, FindIndex(key));
+    }
+
+    bool Contains(const Key& key) const {
+        return FindIndex(key) != GetSize();
+    }
+
+    size_t Count(const Key& key) const {
+        return Contains(key) ? 1 : 0;
+    }
+
+    Value& At(const Key& key) {
+        return values_[CheckedIndex(key)];
+    }
+
+    const Value& At(const Key& key) const {
+        return values_[CheckedIndex(key)];
+    }
+
+    //   ;       
+    Value& operator[](const Key& key) {
+        return values_[TryEmplace(key).first.index_];
+    }
+
+    //      .    
+    template <typename... Args>
+    std::pair<Iterator, bool> TryEmplace(const Key& key, Args&&... args) {
+        const size_t index = LowerBound(key);
+        if (index < GetSize() && !comp_(key, keys_[index])) {
+            return { Iterator(this, index), false };
+        }
+        Index new_index = MakeIndex(GetSize() + 1, [this, index, &key](size_t i) -> const Key& {
+            return i < index ? keys_[i] : i == index ? key : keys_[i - 1];
+        });
+        values_.Emplace(values_.cbegin() + index, std::forward<Args>(args)...);
+        try {
+            keys_.Insert(keys_.cbegin() + index, key);
+        }
+        catch (...) {
+            values_.Erase(values_.cbegin() + index);
+            throw;
+        }
+        index_ = std::move(new_index);
+        return { Iterator(this, index), true };
+    }
+
+    std::pair<Iterator, bool> Insert(const Key& key, const Value& value) {
+        return TryEmplace(key, value);
+    }
+
+    std::pair<Iterator, bool> InsertOrAssign(const Key& key, const Value& value) {
+        auto result = TryEmplace(key, value);
+        if (!result.second) {
+            values_[result.first.index_] = value;
+        }
+        return result;
+    }
+
+    //   [first, last)  :   ,   
+    //   ,    - .    
+    template <typename InputIt, typename = RequireInputIterator<InputIt>>
+    size_t InsertBatch(InputIt first, InputIt last) {
+        SimpleVector<std::pair<Key, Value>> batch;
+        for (; first != last; ++first) {
+            batch.EmplaceBack(*first);
+        }
+        if (batch.IsEmpty()) {
+            return 0;
+        }
+        std::stable_sort(batch.begin(), batch.end(), [this](const auto& lhs, const auto& rhs) {
+            return comp_(lhs.first, rhs.first);
+        });
+
+        const size_t size = GetSize();
+        const auto get = [this, &batch, size](size_t k) -> const Key& {
+            return k < size ? keys_[k] : batch[k - size].first;
+        };
+        const SimpleVector<size_t> plan = flat_detail::MergePlan(size, batch.GetSize(), get, comp_);
+        Index new_index = MakeIndex(plan.GetSize(), [&plan, &get](size_t i) -> const Key& {
+            return get(plan[i]);
+        });
+        Keys merged_keys(::Reserve(plan.GetSize()));
+        Values merged_values(::Reserve(plan.GetSize()));
+        //   ,    ,      :
+        //          
+        constexpr bool kMoveRows = (std::is_nothrow_move_constructible_v<Key> && std::is_nothrow_move_constructible_v<Value>)
+            || !std::is_copy_constructible_v<Key> || !std::is_copy_constructible_v<Value>;
+        for (const size_t k : plan) {
+            if (k >= size) {
+                merged_keys.PushBack(std::move(batch[k - size].first));
+                merged_values.PushBack(std::move(batch[k - size].second));
+            }
+            else if constexpr (kMoveRows) {
+                merged_keys.PushBack(std::move(keys_[k]));
+                merged_values.PushBack(std::move(values_[k]));
+            }
+            else {
+                merged_keys.PushBack(keys_[k]);
+                merged_values.PushBack(values_[k]);
+            }
+        }
+        keys_.swap(merged_keys);
+        values_.swap(merged_values);
+        index_ = std::move(new_index);
+        return plan.GetSize() - size;
+    }
+
+    template <typename Range>
+    size_t InsertBatch(const Range& range) {
+        return InsertBatch(std::begin(range), std::end(range));
+    }
+
+    size_t Erase(const Key& key) {
+        const size_t index = FindIndex(key);
+        if (index == GetSize()) {
+            return 0;
+        }
+        Erase(ConstIterator(this, index));
+        return 1;
+    }
+
+    Iterator Erase(ConstIterator pos) {
+        assert(pos.owner_ == this && pos.index_ < GetSize());
+        const size_t index = pos.index_;
+        Index new_index = MakeIndex(GetSize() - 1, [this, index](size_t i) -> const Key& {
+            return keys_[i < index ? i : i + 1];
+        });
+        keys_.Erase(keys_.cbegin() + index);
+        values_.Erase(values_.cbegin() + index);
+        index_ = std::move(new_index);
+        return Iterator(this, index);
+    }
+
+    void Clear() noexcept {
+        keys_.Clear();
+        values_.Clear();
+        index_ = {};
+    }
+
+    void Reserve(size_t capacity) {
+        keys_.Reserve(capacity);
+        values_.Reserve(capacity);
+    }
+
+    void swap(FlatMap& other) noexcept {
+        using std::swap;
+        keys_.swap(other.keys_);
+        values_.swap(other.values_);
+        swap(comp_, other.comp_);
+        swap(index_, other.index_);
+    }
+
+private:
+    using Index = typename Layout::template Index<Key, Compare>;
+
+    Keys keys_;
+    Values values_;
+    Compare comp_;
+    Index index_;
+
+    size_t LowerBound(const Key& key) const {
+        return index_.LowerBound(keys_.Data(), keys_.GetSize(), key, comp_);
+    }
+
+    //    GetSize(),   
+    size_t FindIndex(const Key& key) const {
+        const size_t index = LowerBound(key);
+        return index < GetSize() && !comp_(key, keys_[index]) ? index : GetSize();
+    }
+
+    size_t CheckedIndex(const Key& key) const {
+        const size_t index = FindIndex(key);
+        if (index == GetSize()) {
+            throw std::out_of_range("Key is not found");
+        }
+        return index;
+    }
+
+    //        , . FlatSet
+    template <typename Get>
+    static Index MakeIndex(size_t size, Get get) {
+        Index index;
+        index.Rebuild(size, get);
+        return index;
+    }
+
+    //    :        
+    template <bool IsConst>
+    class BasicIterator {
+        using Owner = std::conditional_t<IsConst, const FlatMap, FlatMap>;
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = std::pair<Key, Value>;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::conditional_t<IsConst, ConstReference, Reference>;
+        using pointer = void;
+
+        BasicIterator() = default;
+
+        //      
+        template <bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+        BasicIterator(const BasicIterator<OtherConst>& other) noexcept
+            : owner_(other.owner_), index_(other.index_) {
+        }
+
+        reference operator*() const noexcept {
+            return reference(owner_->keys_[index_], owner_->values_[index_]);
+        }
+
+        reference operator[](difference_type offset) const noexcept {
+            return *(*this + offset);
+        }
+
+        BasicIterator& operator++() noexcept {
+            ++index_;
+            return *this;
+        }
+
+        BasicIterator operator++(int) noexcept {
+            BasicIterator old = *this;
+            ++index_;
+            return old;
+        }
+
+        BasicIterator& operator--() noexcept {
+            --index_;
+            return *this;
+        }
+
+        BasicIterator operator--(int) noexcept {
+            BasicIterator old = *this;
+            --index_;
+            return old;
+        }
+
+        BasicIterator& operator+=(difference_type offset) noexcept {
+            index_ += offset;
+            return *this;
+        }
+
+        BasicIterator& operator-=(difference_type offset) noexcept {
+            index_ -= offset;
+            return *this;
+        }
+
+        friend BasicIterator operator+(BasicIterator it, difference_type offset) noexcept {
+            return it += offset;
+        }
+
+        friend BasicIterator operator+(difference_type offset, BasicIterator it) noexcept {
+            return it += offset;
+        }
+
+        friend BasicIterator operator-(BasicIterator it, difference_type offset) noexcept {
+            return it -= offset;
+        }
+
+        friend difference_type operator-(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return static_cast<difference_type>(lhs.index_) - static_cast<difference_type>(rhs.index_);
+        }
+
+        friend bool operator==(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return lhs.index_ == rhs.index_;
+        }
+
+        friend bool operator!=(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return lhs.index_ != rhs.index_;
+        }
+
+        friend bool operator<(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return lhs.index_ < rhs.index_;
+        }
+
+        friend bool operator>(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return rhs < lhs;
+        }
+
+        friend bool operator<=(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return !(rhs < lhs);
+        }
+
+        friend bool operator>=(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return !(lhs < rhs);
+        }
+
+    private:
+        friend class FlatMap;
+        friend class BasicIterator<!IsConst>;
+
+        BasicIterator(Owner* owner, size_t index) noexcept
+            : owner_(owner), index_(index) {
+        }
+
+        Owner* owner_ = nullptr;
+        size_t index_ = 0;
+    };
+};
+
+template <typename Key, typename Value, typename Compare, typename Layout>
+void swap(FlatMap<Key, Value, Compare, Layout>& lhs, FlatMap<Key, Value, Compare, Layout>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+template <typename Key, typename Value, typename Compare, typename Layout>
+bool operator==(const FlatMap<Key, Value, Compare, Layout>& lhs, const FlatMap<Key, Value, Compare, Layout>& rhs) {
+    return lhs.GetKeys() == rhs.GetKeys() && lhs.GetValues() == rhs.GetValues();
+}
+
+template <typename Key, typename Value, typename Compare, typename Layout>
+bool operator!=(const FlatMap<Key, Value, Compare, Layout>& lhs, const FlatMap<Key, Value, Compare, Layout>& rhs) {
+    return !(lhs == rhs);
+}
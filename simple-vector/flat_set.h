@@ -0,0 +1,331 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+#include "simple_vector.h"
+
+//      FlatSet  FlatMap. Index::Rebuild(size, get)  
+//  size ,  get(i) - i-   ,     :  
+//           .
+// Index::LowerBound       key
+
+//         .   
+//    ,      
+struct SortedLayout {
+    template <typename Key, typename Compare>
+    class Index {
+    public:
+        template <typename Get>
+        void Rebuild(size_t, Get) noexcept {
+        }
+
+        size_t LowerBound(const Key* keys, size_t size, const Key& key, const Compare& comp) const {
+            if (size == 0) {
+                return 0;
+            }
+            const Key* first = keys;
+            while (size > 1) {
+                const size_t half = size / 2;
+                first = comp(first[half - 1], key) ? first + half : first;
+                size -= half;
+            }
+            return static_cast<size_t>(first - keys) + (comp(*first, key) ? 1 : 0);
+        }
+    };
+};
+
+//         ( ):   
+//    -,    k (2k  2k + 1)    .
+//         ,    
+struct EytzingerLayout {
+    template <typename Key, typename Compare>
+    class Index {
+    public:
+        template <typename Get>
+        void Rebuild(size_t size, Get get) {
+            SimpleVector<size_t> ranks(size);
+            size_t next = 0;
+            FillRanks(ranks, 1, next);
+            SimpleVector<Key> tree(Reserve(size));
+            for (size_t rank : ranks) {
+                tree.PushBack(get(rank));
+            }
+            tree_.swap(tree);
+            ranks_.swap(ranks);
+        }
+
+        size_t LowerBound(const Key*, size_t size, const Key& key, const Compare& comp) const {
+            assert(size == tree_.GetSize());
+            size_t k = 1;
+            while (k <= size) {
+#if defined(__GNUC__) || defined(__clang__)
+                //  4     16    16k..16k+15
+                __builtin_prefetch(tree_.Data() + std::min(16 * k, size) - 1);
+#endif
+                k = 2 * k + (comp(tree_[k - 1], key) ? 1 : 0);
+            }
+            //    ;       
+            k >>= CountTrailingOnes(k) + 1;
+            return k == 0 ? size : ranks_[k - 1];
+        }
+
+    private:
+        // tree_[k - 1] -   k, ranks_[k - 1] -     
+        SimpleVector<Key> tree_;
+        SimpleVector<size_t> ranks_;
+
+        //           
+        static void FillRanks(SimpleVector<size_t>& ranks, size_t k, size_t& next) {
+            if (k <= ranks.GetSize()) {
+                FillRanks(ranks, 2 * k, next);
+                ranks[k - 1] = next++;
+                FillRanks(ranks, 2 * k + 1, next);
+            }
+        }
+
+        static size_t CountTrailingOnes(size_t value) noexcept {
+            const unsigned long long inverted = ~static_cast<unsigned long long>(value);
+#if defined(_MSC_VER) && !defined(__clang__)
+            unsigned long bit;
+            _BitScanForward64(&bit, inverted);
+            return bit;
+#else
+            return static_cast<size_t>(__builtin_ctzll(inverted));
+#endif
+        }
+    };
+};
+
+namespace flat_detail {
+
+//   size       batch_size :  
+//    ,  get(k)  k < size -  ,    k - size.
+//     ,    .     ,
+//        
+template <typename Get, typename Compare>
+SimpleVector<size_t> MergePlan(size_t size, size_t batch_size, Get get, const Compare& comp) {
+    SimpleVector<size_t> plan(::Reserve(size + batch_size));
+    size_t i = 0;
+    size_t j = size;
+    while (i < size || j < size + batch_size) {
+        if (j == size + batch_size || (i < size && !comp(get(j), get(i)))) {
+            plan.PushBack(i++);
+        }
+        else if (plan.IsEmpty() || comp(get(plan[plan.GetSize() - 1]), get(j))) {
+            plan.PushBack(j++);
+        }
+        else {
+            ++j;
+        }
+    }
+    return plan;
+}
+
+} // namespace flat_detail
+
+//    SimpleVector:  -    , 
+//  - O(n)  . InsertBatch         
+//   ,     O(n + m log m),   O(n * m)
+template <typename Key, typename Compare = std::less<Key>, typename Layout = SortedLayout,
+          typename Allocator = std::allocator<Key>>
+class FlatSet {
+    using Keys = SimpleVector<Key, Allocator>;
+
+public:
+    using Iterator = typename Keys::ConstIterator;
+    using ConstIterator = typename Keys::ConstIterator;
+
+    FlatSet() = default;
+
+    explicit FlatSet(const Compare& comp, const Allocator& alloc = Allocator()) :
+        keys_(alloc), comp_(comp) {
+    }
+
+    FlatSet(std::initializer_list<Key> init, const Compare& comp = Compare(), const Allocator& alloc = Allocator()) :
+        FlatSet(init.begin(), init.end(), comp, alloc) {
+    }
+
+    template <typename InputIt, typename = RequireInputIterator<InputIt>>
+    FlatSet(InputIt first, InputIt last, const Compare& comp = Compare(), const Allocator& alloc = Allocator()) :
+        keys_(alloc), comp_(comp) {
+        InsertBatch(first, last);
+    }
+
+    size_t GetSize() const noexcept {
+        return keys_.GetSize();
+    }
+
+    bool IsEmpty() const noexcept {
+        return keys_.IsEmpty();
+    }
+
+    //   ,     SimpleVector
+    const Keys& GetKeys() const noexcept {
+        return keys_;
+    }
+
+    ConstIterator begin() const noexcept {
+        return keys_.begin();
+    }
+
+    ConstIterator end() const noexcept {
+        return keys_.end();
+    }
+
+    ConstIterator cbegin() const noexcept {
+        return begin();
+    }
+
+    ConstIterator cend() const noexcept {
+        return end();
+    }
+
+    ConstIterator LowerBound(const Key& key) const {
+        return keys_.begin() + index_.LowerBound(keys_.Data(), keys_.GetSize(), key, comp_);
+    }
+
+    ConstIterator UpperBound(const Key& key) const {
+        return std::upper_bound(keys_.begin(), keys_.end(), key, comp_);
+    }
+
+    ConstIterator Find(const Key& key) const {
+        const ConstIterator it = LowerBound(key);
+        return it != end() && !comp_(key, *it) ? it : end();
+    }
+
+    bool Contains(const Key& key) const {
+        return Find(key) != end();
+    }
+
+    size_t Count(const Key& key) const {
+        return Contains(key) ? 1 : 0;
+    }
+
+    //      .      ,    
+    std::pair<ConstIterator, bool> Insert(const Key& key) {
+        const size_t index = index_.LowerBound(keys_.Data(), keys_.GetSize(), key, comp_);
+        if (index < keys_.GetSize() && !comp_(key, keys_[index])) {
+            return { keys_.begin() + index, false };
+        }
+        Index new_index = MakeIndex(keys_.GetSize() + 1, [this, index, &key](size_t i) -> const Key& {
+            return i < index ? keys_[i] : i == index ? key : keys_[i - 1];
+        });
+        keys_.Insert(keys_.cbegin() + index, key);
+        index_ = std::move(new_index);
+        return { keys_.begin() + index, true };
+    }
+
+    //   [first, last)  .    
+    template <typename InputIt, typename = RequireInputIterator<InputIt>>
+    size_t InsertBatch(InputIt first, InputIt last) {
+        Keys batch(first, last, keys_.GetAllocator());
+        if (batch.IsEmpty()) {
+            return 0;
+        }
+        std::sort(batch.begin(), batch.end(), comp_);
+
+        const size_t size = keys_.GetSize();
+        const auto get = [this, &batch, size](size_t k) -> const Key& {
+            return k < size ? keys_[k] : batch[k - size];
+        };
+        const SimpleVector<size_t> plan = flat_detail::MergePlan(size, batch.GetSize(), get, comp_);
+        Index new_index = MakeIndex(plan.GetSize(), [&plan, &get](size_t i) -> const Key& {
+            return get(plan[i]);
+        });
+        //   ,      
+        Keys merged(::Reserve(plan.GetSize()), keys_.GetAllocator());
+        for (const size_t k : plan) {
+            if (k < size) {
+                merged.PushBack(std::move_if_noexcept(keys_[k]));
+            }
+            else {
+                merged.PushBack(std::move(batch[k - size]));
+            }
+        }
+        keys_.swap(merged);
+        index_ = std::move(new_index);
+        return plan.GetSize() - size;
+    }
+
+    template <typename Range>
+    size_t InsertBatch(const Range& range) {
+        return InsertBatch(std::begin(range), std::end(range));
+    }
+
+    size_t Erase(const Key& key) {
+        const ConstIterator it = Find(key);
+        if (it == end()) {
+            return 0;
+        }
+        Erase(it);
+        return 1;
+    }
+
+    ConstIterator Erase(ConstIterator pos) {
+        const size_t index = pos - begin();
+        Index new_index = MakeIndex(keys_.GetSize() - 1, [this, index](size_t i) -> const Key& {
+            return keys_[i < index ? i : i + 1];
+        });
+        keys_.Erase(pos);
+        index_ = std::move(new_index);
+        return keys_.begin() + index;
+    }
+
+    void Clear() noexcept {
+        keys_.Clear();
+        index_ = {};
+    }
+
+    void Reserve(size_t capacity) {
+        keys_.Reserve(capacity);
+    }
+
+    void swap(FlatSet& other) noexcept {
+        using std::swap;
+        keys_.swap(other.keys_);
+        swap(comp_, other.comp_);
+        swap(index_, other.index_);
+    }
+
+private:
+    using Index = typename Layout::template Index<Key, Compare>;
+    static_assert(std::is_nothrow_move_assignable_v<Index>, "Layout index must be nothrow move assignable");
+
+    Keys keys_;
+    Compare comp_;
+    Index index_;
+
+    template <typename Get>
+    static Index MakeIndex(size_t size, Get get) {
+        Index index;
+        index.Rebuild(size, get);
+        return index;
+    }
+};
+
+template <typename Key, typename Compare, typename Layout, typename Allocator>
+void swap(FlatSet<Key, Compare, Layout, Allocator>& lhs, FlatSet<Key, Compare, Layout, Allocator>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+template <typename Key, typename Compare, typename Layout, typename Allocator>
+bool operator==(const FlatSet<Key, Compare, Layout, Allocator>& lhs, const FlatSet<Key, Compare, Layout, Allocator>& rhs) {
+    return lhs.GetKeys() == rhs.GetKeys();
+}
+
+template <typename Key, typename Compare, typename Layout, typename Allocator>
+bool operator!=(const FlatSet<Key, Compare, Layout, Allocator>& lhs, const FlatSet<Key, Compare, Layout, Allocator>& rhs) {
+    return !(lhs == rhs);
+}
@@ -0,0 +1,503 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "array_ptr.h"
+#include "growth_policy.h"
+#include "simple_vector.h"
+
+//    (gap buffer):      ,    
+//  .    [0, gap_begin_)  [gap_end_, capacity).   
+//     ,        O(
+//   ),   O( )   ,   SimpleVector::Insert
+template <typename Type, typename Allocator = std::allocator<Type>, typename GrowthPolicy = DoublingGrowth>
+class GapVector {
+    template <bool IsConst>
+    class BasicIterator;
+
+public:
+    using Iterator = BasicIterator<false>;
+    using ConstIterator = BasicIterator<true>;
+
+    GapVector() noexcept(noexcept(Allocator())) = default;
+
+    explicit GapVector(const Allocator& alloc) noexcept :
+        items_(alloc) {
+    }
+
+    explicit GapVector(size_t size, const Allocator& alloc = Allocator()) :
+        items_(ArrayPtr<Type, Allocator>::MakeValueInitialized(size, alloc)), gap_begin_(size), gap_end_(size) {
+    }
+
+    GapVector(size_t size, const Type& value, const Allocator& alloc = Allocator()) :
+        items_(size, alloc) {
+        items_.UninitializedFill(items_.Get(), size, value);
+        gap_begin_ = gap_end_ = size;
+    }
+
+    GapVector(std::initializer_list<Type> init, const Allocator& alloc = Allocator()) :
+        GapVector(init.begin(), init.end(), alloc) {
+    }
+
+    template <typename InputIt, typename = RequireInputIterator<InputIt>>
+    GapVector(InputIt first, InputIt last, const Allocator& alloc = Allocator()) :
+        items_(alloc) {
+        Insert(cend(), first, last);
+    }
+
+    GapVector(const GapVector& other) :
+        GapVector(other.begin(), other.end(), std::allocator_traits<Allocator>::select_on_container_copy_construction(other.GetAllocator())) {
+    }
+
+    GapVector(GapVector&& other) noexcept :
+        items_(std::move(other.items_)),
+        gap_begin_(std::exchange(other.gap_begin_, 0)),
+        gap_end_(std::exchange(other.gap_end_, 0)) {
+    }
+
+    ~GapVector() {
+        DestroyAll();
+    }
+
+    GapVector& operator=(const GapVector& rhs) {
+        if (this != &rhs) {
+            GapVector tmp(rhs);
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    GapVector& operator=(GapVector&& rhs) noexcept {
+        if (this != &rhs) {
+            GapVector tmp(std::move(rhs));
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    Allocator GetAllocator() const noexcept {
+        return items_.GetAllocator();
+    }
+
+    size_t GetSize() const noexcept {
+        return items_.GetSize() - GapSize();
+    }
+
+    size_t GetCapacity() const noexcept {
+        return items_.GetSize();
+    }
+
+    bool IsEmpty() const noexcept {
+        return GetSize() == 0;
+    }
+
+    //   - ,        
+    size_t GetGapPosition() const noexcept {
+        return gap_begin_;
+    }
+
+    Type& operator[](size_t index) noexcept {
+        assert(index < GetSize());
+        return *Slot(index);
+    }
+
+    const Type& operator[](size_t index) const noexcept {
+        assert(index < GetSize());
+        return *Slot(index);
+    }
+
+    Type& At(size_t index) {
+        if (index >= GetSize()) {
+            throw std::out_of_range("Index is Out of Range");
+        }
+        return *Slot(index);
+    }
+
+    const Type& At(size_t index) const {
+        if (index >= GetSize()) {
+            throw std::out_of_range("Index is Out of Range");
+        }
+        return *Slot(index);
+    }
+
+    Iterator begin() noexcept {
+        return Iterator(this, 0);
+    }
+
+    Iterator end() noexcept {
+        return Iterator(this, GetSize());
+    }
+
+    ConstIterator begin() const noexcept {
+        return ConstIterator(this, 0);
+    }
+
+    ConstIterator end() const noexcept {
+        return ConstIterator(this, GetSize());
+    }
+
+    ConstIterator cbegin() const noexcept {
+        return begin();
+    }
+
+    ConstIterator cend() const noexcept {
+        return end();
+    }
+
+    void PushBack(const Type& item) {
+        EmplaceAt(GetSize(), item);
+    }
+
+    void PushBack(Type&& item) {
+        EmplaceAt(GetSize(), std::move(item));
+    }
+
+    template <typename... Args>
+    Type& EmplaceBack(Args&&... args) {
+        return *EmplaceAt(GetSize(), std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    Iterator Emplace(ConstIterator pos, Args&&... args) {
+        const size_t index = IndexOf(pos);
+        EmplaceAt(index, std::forward<Args>(args)...);
+        return Iterator(this, index);
+    }
+
+    Iterator Insert(ConstIterator pos, const Type& value) {
+        return Emplace(pos, value);
+    }
+
+    Iterator Insert(ConstIterator pos, Type&& value) {
+        return Emplace(pos, std::move(value));
+    }
+
+    //  [first, last):    pos  ,     
+    template <typename InputIt, typename = RequireInputIterator<InputIt>>
+    Iterator Insert(ConstIterator pos, InputIt first, InputIt last) {
+        const size_t index = IndexOf(pos);
+        if constexpr (IsForwardIteratorV<InputIt>) {
+            const size_t count = static_cast<size_t>(std::distance(first, last));
+            if (count > GapSize()) {
+                Grow(GetSize() + count);
+            }
+        }
+        size_t inserted = index;
+        for (; first != last; ++first) {
+            EmplaceAt(inserted++, *first);
+        }
+        return Iterator(this, index);
+    }
+
+    void PopBack() {
+        assert(!IsEmpty());
+        EraseAt(GetSize() - 1, 1);
+    }
+
+    Iterator Erase(ConstIterator pos) {
+        const size_t index = IndexOf(pos);
+        assert(index < GetSize());
+        EraseAt(index, 1);
+        return Iterator(this, index);
+    }
+
+    Iterator Erase(ConstIterator first, ConstIterator last) {
+        const size_t index = IndexOf(first);
+        const size_t last_index = IndexOf(last);
+        assert(index <= last_index);
+        EraseAt(index, last_index - index);
+        return Iterator(this, index);
+    }
+
+    void Clear() noexcept {
+        DestroyAll();
+        gap_begin_ = 0;
+        gap_end_ = GetCapacity();
+    }
+
+    void Reserve(size_t new_capacity) {
+        if (new_capacity > GetCapacity()) {
+            Grow(new_capacity);
+        }
+    }
+
+    //    ,         .
+    //     
+    Type* AsContiguous() {
+        MoveGap(GetSize());
+        return items_.Get();
+    }
+
+    void swap(GapVector& other) noexcept {
+        items_.swap(other.items_);
+        std::swap(gap_begin_, other.gap_begin_);
+        std::swap(gap_end_, other.gap_end_);
+    }
+
+private:
+    ArrayPtr<Type, Allocator> items_;
+    size_t gap_begin_ = 0;
+    size_t gap_end_ = 0;
+
+    size_t GapSize() const noexcept {
+        return gap_end_ - gap_begin_;
+    }
+
+    Type* Slot(size_t index) const noexcept {
+        return items_.Get() + (index < gap_begin_ ? index : index + GapSize());
+    }
+
+    size_t IndexOf(ConstIterator pos) const noexcept {
+        assert(pos.owner_ == this && pos.index_ <= GetSize());
+        return pos.index_;
+    }
+
+    void DestroyAll() noexcept {
+        items_.Destroy(items_.Get(), items_.Get() + gap_begin_);
+        items_.Destroy(items_.Get() + gap_end_, items_.Get() + GetCapacity());
+    }
+
+    //      from    to
+    void Relocate(Type* from, Type* to) {
+        items_.Construct(to, std::move_if_noexcept(*from));
+        items_.Destroy(from, from + 1);
+    }
+
+    //   ,     index.     
+    //    
+    void MoveGap(size_t index) {
+        assert(index <= GetSize());
+        Type* data = items_.Get();
+        if (index < gap_begin_) {
+            const size_t count = gap_begin_ - index;
+            if constexpr (IsTriviallyRelocatableV<Type>) {
+                std::memmove(static_cast<void*>(data + gap_end_ - count), static_cast<const void*>(data + index), count * sizeof(Type));
+                gap_begin_ = index;
+                gap_end_ -= count;
+            }
+            else {
+                while (gap_begin_ > index) {
+                    Relocate(data + gap_begin_ - 1, data + gap_end_ - 1);
+                    --gap_begin_;
+                    --gap_end_;
+                }
+            }
+        }
+        else if (index > gap_begin_) {
+            const size_t count = index - gap_begin_;
+            if constexpr (IsTriviallyRelocatableV<Type>) {
+                std::memmove(static_cast<void*>(data + gap_begin_), static_cast<const void*>(data + gap_end_), count * sizeof(Type));
+                gap_begin_ = index;
+                gap_end_ += count;
+            }
+            else {
+                while (gap_begin_ < index) {
+                    Relocate(data + gap_end_, data + gap_begin_);
+                    ++gap_begin_;
+                    ++gap_end_;
+                }
+            }
+        }
+    }
+
+    //    required    ,   
+    void Grow(size_t required) {
+        const size_t new_capacity = std::max(required, GrowthPolicy::NextCapacity(GetCapacity(), required, sizeof(Type)));
+        const size_t tail = GetCapacity() - gap_end_;
+        ArrayPtr<Type, Allocator> new_items(new_capacity, items_.GetAllocator());
+        Type* data = items_.Get();
+        Type* new_data = new_items.Get();
+        if constexpr (IsTriviallyRelocatableV<Type>) {
+            if (gap_begin_ != 0) {
+                std::memcpy(static_cast<void*>(new_data), static_cast<const void*>(data), gap_begin_ * sizeof(Type));
+            }
+            if (tail != 0) {
+                std::memcpy(static_cast<void*>(new_data + new_capacity - tail), static_cast<const void*>(data + gap_end_), tail * sizeof(Type));
+            }
+        }
+        else {
+            TransferItems(new_items, data, data + gap_begin_, new_data);
+            try {
+                TransferItems(new_items, data + gap_end_, data + GetCapacity(), new_data + new_capacity - tail);
+            }
+            catch (...) {
+                new_items.Destroy(new_data, new_data + gap_begin_);
+                throw;
+            }
+            DestroyAll();
+        }
+        items_.swap(new_items);
+        gap_end_ = new_capacity - tail;
+    }
+
+    static void TransferItems(ArrayPtr<Type, Allocator>& storage, Type* first, Type* last, Type* dest) {
+        if constexpr (std::is_nothrow_move_constructible_v<Type> || !std::is_copy_constructible_v<Type>) {
+            storage.UninitializedCopy(std::make_move_iterator(first), std::make_move_iterator(last), dest);
+        }
+        else {
+            storage.UninitializedCopy(first, last, dest);
+        }
+    }
+
+    template <typename... Args>
+    Type* EmplaceAt(size_t index, Args&&... args) {
+        if (gap_begin_ == gap_end_ || index != gap_begin_) {
+            // args       ,     
+            Type tmp(std::forward<Args>(args)...);
+            if (gap_begin_ == gap_end_) {
+                Grow(GetSize() + 1);
+            }
+            MoveGap(index);
+            items_.Construct(items_.Get() + gap_begin_, std::move(tmp));
+        }
+        else {
+            items_.Construct(items_.Get() + gap_begin_, std::forward<Args>(args)...);
+        }
+        return items_.Get() + gap_begin_++;
+    }
+
+    //  count    index:    index   
+    void EraseAt(size_t index, size_t count) {
+        MoveGap(index);
+        items_.Destroy(items_.Get() + gap_end_, items_.Get() + gap_end_ + count);
+        gap_end_ += count;
+    }
+
+    template <bool IsConst>
+    class BasicIterator {
+        using Owner = std::conditional_t<IsConst, const GapVector, GapVector>;
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const Type*, Type*>;
+        using reference = std::conditional_t<IsConst, const Type&, Type&>;
+
+        BasicIterator() = default;
+
+        //      
+        template <bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+        BasicIterator(const BasicIterator<OtherConst>& other) noexcept
+            : owner_(other.owner_), index_(other.index_) {
+        }
+
+        reference operator*() const noexcept {
+            return *operator->();
+        }
+
+        pointer operator->() const noexcept {
+            return owner_->Slot(index_);
+        }
+
+        reference operator[](difference_type offset) const noexcept {
+            return *(*this + offset);
+        }
+
+        BasicIterator& operator++() noexcept {
+            ++index_;
+            return *this;
+        }
+
+        BasicIterator operator++(int) noexcept {
+            BasicIterator old = *this;
+            ++index_;
+            return old;
+        }
+
+        BasicIterator& operator--() noexcept {
+            --index_;
+            return *this;
+        }
+
+        BasicIterator operator--(int) noexcept {
+            BasicIterator old = *this;
+            --index_;
+            return old;
+        }
+
+        BasicIterator& operator+=(difference_type offset) noexcept {
+            index_ += offset;
+            return *this;
+        }
+
+        BasicIterator& operator-=(difference_type offset) noexcept {
+            index_ -= offset;
+            return *this;
+        }
+
+        friend BasicIterator operator+(BasicIterator it, difference_type offset) noexcept {
+            return it += offset;
+        }
+
+        friend BasicIterator operator+(difference_type offset, BasicIterator it) noexcept {
+            return it += offset;
+        }
+
+        friend BasicIterator operator-(BasicIterator it, difference_type offset) noexcept {
+            return it -= offset;
+        }
+
+        friend difference_type operator-(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return static_cast<difference_type>(lhs.index_) - static_cast<difference_type>(rhs.index_);
+        }
+
+        friend bool operator==(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return lhs.index_ == rhs.index_;
+        }
+
+        friend bool operator!=(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return lhs.index_ != rhs.index_;
+        }
+
+        friend bool operator<(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return lhs.index_ < rhs.index_;
+        }
+
+        friend bool operator>(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return rhs < lhs;
+        }
+
+        friend bool operator<=(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return !(rhs < lhs);
+        }
+
+        friend bool operator>=(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return !(lhs < rhs);
+        }
+
+    private:
+        friend class GapVector;
+        friend class BasicIterator<!IsConst>;
+
+        BasicIterator(Owner* owner, size_t index) noexcept
+            : owner_(owner), index_(index) {
+        }
+
+        Owner* owner_ = nullptr;
+        size_t index_ = 0;
+    };
+};
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+void swap(GapVector<Type, Allocator, GrowthPolicy>& lhs, GapVector<Type, Allocator, GrowthPolicy>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+bool operator==(const GapVector<Type, Allocator, GrowthPolicy>& lhs, const GapVector<Type, Allocator, GrowthPolicy>& rhs) {
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+bool operator!=(const GapVector<Type, Allocator, GrowthPolicy>& lhs, const GapVector<Type, Allocator, GrowthPolicy>& rhs) {
+    return !(lhs == rhs);
+}
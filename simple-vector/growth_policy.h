@@ -0,0 +1,45 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+
+//    SimpleVector. NextCapacity   , 
+//          (  required)
+
+//  
+struct DoublingGrowth {
+    static size_t NextCapacity(size_t capacity, size_t required, size_t /*item_size*/) noexcept {
+        return std::max(required, capacity * 2);
+    }
+};
+
+//   1.5 :         ,
+//        
+struct OneAndHalfGrowth {
+    static size_t NextCapacity(size_t capacity, size_t required, size_t /*item_size*/) noexcept {
+        return std::max(required, capacity + capacity / 2 + 1);
+    }
+};
+
+//   1.5        :  
+//    ,  -    
+template <size_t PageSize = 4096>
+struct SizeClassGrowth {
+    static_assert((PageSize & (PageSize - 1)) == 0, "PageSize must be a power of two");
+
+    static size_t NextCapacity(size_t capacity, size_t required, size_t item_size) noexcept {
+        const size_t target = std::max(required, capacity + capacity / 2 + 1);
+        size_t bytes = target * item_size;
+        if (bytes <= PageSize) {
+            size_t size_class = 16;
+            while (size_class < bytes) {
+                size_class *= 2;
+            }
+            bytes = size_class;
+        }
+        else {
+            bytes = (bytes + PageSize - 1) & ~(PageSize - 1);
+        }
+        return std::max(target, bytes / item_size);
+    }
+};
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <unistd.h>
+#define SIMPLE_VECTOR_MMAP_ALLOCATOR
+#endif
+
+#include "array_ptr.h"
+#include "growth_policy.h"
+#include "simple_vector.h"
+
+//    .   ThresholdBytes     mmap:
+// -       ,  SimpleVector<int>(n)    (AllocateZeroed);
+// -     huge pages (MADV_HUGEPAGE),    TLB;
+// -       mremap   .
+//      mmap  std::allocator
+template <typename Type, size_t ThresholdBytes = size_t{ 1 } << 21>
+struct LargeBufferAllocator {
+    using value_type = Type;
+
+    template <typename Other>
+    struct rebind {
+        using other = LargeBufferAllocator<Other, ThresholdBytes>;
+    };
+
+    LargeBufferAllocator() noexcept = default;
+
+    template <typename Other>
+    LargeBufferAllocator(const LargeBufferAllocator<Other, ThresholdBytes>&) noexcept {
+    }
+
+    Type* allocate(size_t size) {
+        if (IsLarge(size)) {
+            return MapPages(size);
+        }
+        return std::allocator<Type>().allocate(size);
+    }
+
+    Type* AllocateZeroed(size_t size) {
+        if (IsLarge(size)) {
+            return MapPages(size);
+        }
+        Type* raw_ptr = std::allocator<Type>().allocate(size);
+        std::memset(static_cast<void*>(raw_ptr), 0, size * sizeof(Type));
+        return raw_ptr;
+    }
+
+    void deallocate(Type* raw_ptr, size_t size) noexcept {
+#ifdef SIMPLE_VECTOR_MMAP_ALLOCATOR
+        if (IsLarge(size)) {
+            ::munmap(raw_ptr, MappedBytes(size));
+            return;
+        }
+#endif
+        std::allocator<Type>().deallocate(raw_ptr, size);
+    }
+
+    //    mmap -  Linux    mremap,      
+    Type* Reallocate(Type* raw_ptr, size_t old_size, size_t new_size) {
+#if defined(SIMPLE_VECTOR_MMAP_ALLOCATOR) && defined(__linux__)
+        if (IsLarge(old_size) && IsLarge(new_size)) {
+            void* new_ptr = ::mremap(raw_ptr, MappedBytes(old_size), MappedBytes(new_size), MREMAP_MAYMOVE);
+            if (new_ptr == MAP_FAILED) {
+                throw std::bad_alloc();
+            }
+            return static_cast<Type*>(new_ptr);
+        }
+#endif
+        Type* new_ptr = allocate(new_size);
+        std::memcpy(static_cast<void*>(new_ptr), static_cast<const void*>(raw_ptr), std::min(old_size, new_size) * sizeof(Type));
+        deallocate(raw_ptr, old_size);
+        return new_ptr;
+    }
+
+    template <typename Other>
+    bool operator==(const LargeBufferAllocator<Other, ThresholdBytes>&) const noexcept {
+        return true;
+    }
+
+    template <typename Other>
+    bool operator!=(const LargeBufferAllocator<Other, ThresholdBytes>&) const noexcept {
+        return false;
+    }
+
+private:
+    static bool IsLarge([[maybe_unused]] size_t size) noexcept {
+#ifdef SIMPLE_VECTOR_MMAP_ALLOCATOR
+        return size >= (ThresholdBytes + sizeof(Type) - 1) / sizeof(Type);
+#else
+        return false;
+#endif
+    }
+
+#ifdef SIMPLE_VECTOR_MMAP_ALLOCATOR
+    static size_t MappedBytes(size_t size) noexcept {
+        static const size_t page_size = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+        return (size * sizeof(Type) + page_size - 1) & ~(page_size - 1);
+    }
+
+    static Type* MapPages(size_t size) {
+        if (size > (SIZE_MAX >> 1) / sizeof(Type)) {
+            throw std::bad_array_new_length();
+        }
+        const size_t bytes = MappedBytes(size);
+        void* raw_ptr = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (raw_ptr == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+#ifdef MADV_HUGEPAGE
+        //  :   THP   ,      
+        ::madvise(raw_ptr, bytes, MADV_HUGEPAGE);
+#endif
+        return static_cast<Type*>(raw_ptr);
+    }
+#else
+    static Type* MapPages(size_t size) {
+        return std::allocator<Type>().allocate(size);
+    }
+#endif
+};
+
+template <typename Type, typename GrowthPolicy = DoublingGrowth, typename CheckPolicy = AssertPolicy>
+using LargeSimpleVector = SimpleVector<Type, LargeBufferAllocator<Type>, GrowthPolicy, CheckPolicy>;
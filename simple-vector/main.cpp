@@ -1,9 +1,39 @@
+//    ,    ; -DSIMPLE_VECTOR_NO_STATS    
+#ifndef SIMPLE_VECTOR_NO_STATS
+#define SIMPLE_VECTOR_STATS
+#endif
+
 #include "simple_vector.h"
+#include "small_vector.h"
+#include "parallel.h"
+#include "concurrent_vector.h"
+#include "segmented_vector.h"
+#include "mapped_vector.h"
+#include "serialization.h"
+#include "large_allocator.h"
+#include "soa_vector.h"
+#include "shared_vector.h"
+#include "persistent_vector.h"
+#include "gap_vector.h"
+#include "flat_set.h"
+#include "flat_map.h"
+#include "bit_vector.h"
 #include "old_tests.h"
 
 #include <cassert>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
 #include <iostream>
+#include <iterator>
+#include <map>
 #include <numeric>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <typeinfo>
+#include <vector>
 
 using namespace std;
 
@@ -37,6 +67,67 @@ private:
     size_t x_;
 };
 
+//     ,    
+class Counted {
+public:
+    explicit Counted(int value)
+        : value_(value) {
+        ++alive;
+    }
+
+    Counted(const Counted& other)
+        : value_(other.value_) {
+        ++alive;
+    }
+
+    Counted& operator=(const Counted& other) = default;
+
+    ~Counted() {
+        --alive;
+    }
+
+    int GetValue() const {
+        return value_;
+    }
+
+    static inline int alive = 0;
+
+private:
+    int value_;
+};
+
+//  :   ,    
+class Handle {
+public:
+    explicit Handle(int value)
+        : value_(new int(value)) {
+    }
+
+    Handle(Handle&& other) noexcept
+        : value_(exchange(other.value_, nullptr)) {
+    }
+
+    Handle& operator=(Handle&& other) noexcept {
+        delete exchange(value_, exchange(other.value_, nullptr));
+        return *this;
+    }
+
+    ~Handle() {
+        delete value_;
+    }
+
+    int GetValue() const {
+        return *value_;
+    }
+
+private:
+    int* value_;
+};
+
+template <>
+struct IsTriviallyRelocatable<Handle> : std::true_type {
+};
+
 SimpleVector<int> GenerateVector(size_t size) {
     SimpleVector<int> v(size);
     iota(v.begin(), v.end(), 1);
@@ -196,6 +287,1304 @@ void TestNoncopiableErase() {
     cout << "Done!" << endl << endl;
 }
 
+void TestRawStorage() {
+    cout << "Test raw storage, elements are constructed on demand" << endl;
+    {
+        SimpleVector<Counted> v(Reserve(100));
+        assert(Counted::alive == 0);
+
+        v.PushBack(Counted(1));
+        v.PushBack(Counted(2));
+        v.Insert(v.begin(), Counted(0));
+        assert(Counted::alive == 3);
+        assert(v.GetCapacity() == 100);
+
+        v.Erase(v.begin() + 1);
+        assert(Counted::alive == 2);
+        assert(v[0].GetValue() == 0 && v[1].GetValue() == 2);
+
+        v.PopBack();
+        assert(Counted::alive == 1);
+
+        v.Reserve(1000);
+        assert(Counted::alive == 1);
+        assert(v[0].GetValue() == 0);
+    }
+    assert(Counted::alive == 0);
+
+    {
+        SimpleVector<int> v{ 1, 2, 3 };
+        //     
+        v.PushBack(v[0]);
+        v.Insert(v.begin(), v[3]);
+        assert((v == SimpleVector<int>{1, 1, 2, 3, 1}));
+    }
+    cout << "Done!" << endl << endl;
+}
+
+void TestPmrAllocator() {
+    cout << "Test pmr allocator" << endl;
+    std::byte buffer[1024];
+    std::pmr::monotonic_buffer_resource resource(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+
+    ::pmr::SimpleVector<int> v(&resource);
+    for (int i = 0; i < 10; ++i) {
+        v.PushBack(i);
+    }
+    assert(v.GetSize() == 10);
+    assert(v.GetAllocator().resource() == &resource);
+    assert(reinterpret_cast<std::byte*>(v.begin()) >= buffer);
+    assert(reinterpret_cast<std::byte*>(v.end()) <= buffer + sizeof(buffer));
+
+    //  pmr-       
+    ::pmr::SimpleVector<std::pmr::string> strings(&resource);
+    strings.PushBack("a long enough string to leave the small buffer");
+    assert(strings[0].get_allocator().resource() == &resource);
+
+    //        ,   
+    ::pmr::SimpleVector<int> other(std::pmr::new_delete_resource());
+    other = std::move(v);
+    assert(other.GetAllocator().resource() == std::pmr::new_delete_resource());
+    assert(other.GetSize() == 10 && other[9] == 9);
+    cout << "Done!" << endl << endl;
+}
+
+void TestTriviallyRelocatable() {
+    cout << "Test trivially relocatable types" << endl;
+    {
+        SimpleVector<uint64_t, MallocAllocator<uint64_t>> v;
+        for (uint64_t i = 0; i < 1000; ++i) {
+            v.PushBack(i);
+        }
+        v.Insert(v.begin(), 1000u);
+        v.Insert(v.begin() + 500, 1001u);
+        v.Erase(v.begin() + 1);
+        assert(v.GetSize() == 1001);
+        assert(v[0] == 1000 && v[1] == 1 && v[498] == 498 && v[499] == 1001 && v[500] == 499 && v[1000] == 999);
+
+        v.Reserve(100000);
+        assert(v.GetCapacity() == 100000);
+        assert(v[1000] == 999);
+    }
+    {
+        SimpleVector<Handle> v;
+        for (int i = 0; i < 10; ++i) {
+            v.Insert(v.begin(), Handle(i));
+        }
+        v.Erase(v.begin() + 3);
+        v.Erase(v.end() - 1);
+        assert(v.GetSize() == 8);
+        assert(v[0].GetValue() == 9 && v[3].GetValue() == 5 && v[7].GetValue() == 1);
+    }
+    cout << "Done!" << endl << endl;
+}
+
+void TestSmallSimpleVector() {
+    cout << "Test small vector with inline storage" << endl;
+    {
+        SmallSimpleVector<int, 4> v;
+        assert(v.GetCapacity() == 4);
+        for (int i = 0; i < 4; ++i) {
+            v.PushBack(i);
+        }
+        assert(v.IsInline());
+
+        v.Insert(v.begin(), -1);
+        assert(!v.IsInline());
+        assert(v.GetSize() == 5 && v.GetCapacity() == 8);
+        assert((v == SmallSimpleVector<int, 4>{-1, 0, 1, 2, 3}));
+
+        v.Erase(v.begin() + 2);
+        assert((v == SmallSimpleVector<int, 4>{-1, 0, 2, 3}));
+    }
+    {
+        SmallSimpleVector<X, 2> inline_vector;
+        inline_vector.PushBack(X(1));
+        SmallSimpleVector<X, 2> heap_vector;
+        for (size_t i = 0; i < 5; ++i) {
+            heap_vector.PushBack(X(i));
+        }
+
+        inline_vector.swap(heap_vector);
+        assert(inline_vector.GetSize() == 5 && !inline_vector.IsInline());
+        assert(heap_vector.GetSize() == 1 && heap_vector.IsInline());
+        assert(heap_vector[0].GetX() == 1 && inline_vector[4].GetX() == 4);
+
+        SmallSimpleVector<X, 2> moved_vector(std::move(heap_vector));
+        assert(moved_vector[0].GetX() == 1 && heap_vector.IsEmpty());
+    }
+    {
+        SmallSimpleVector<std::string, 2> v{ "a", "b", "c" };
+        SmallSimpleVector<std::string, 2> copy(v);
+        copy.Resize(1);
+        assert(copy[0] == "a" && v.GetSize() == 3);
+    }
+    {
+        //          
+        SmallSimpleVector<int, 2, std::allocator<int>, OneAndHalfGrowth> v{ 1, 2 };
+        v.PushBack(3);
+        assert(!v.IsInline() && v.GetCapacity() == 4);
+        v.PushBack(4);
+        v.PushBack(5);
+        assert(v.GetCapacity() == 7 && v[4] == 5);
+    }
+    cout << "Done!" << endl << endl;
+}
+
+void TestEmplace() {
+    cout << "Test emplace" << endl;
+    SimpleVector<std::pair<std::string, X>> v;
+    [[maybe_unused]] auto& back = v.EmplaceBack("b", 2);
+    assert(back.first == "b" && back.second.GetX() == 2);
+
+    v.EmplaceBack(std::string(3, 'c'), 3);
+    [[maybe_unused]] auto it = v.Emplace(v.begin(), "a", 1);
+    assert(it == v.begin());
+    v.Emplace(v.end(), "d", 4);
+
+    assert(v.GetSize() == 4);
+    assert(v[0].first == "a" && v[1].first == "b" && v[2].first == "ccc" && v[3].first == "d");
+    assert(v[0].second.GetX() == 1 && v[3].second.GetX() == 4);
+
+    SmallSimpleVector<std::string, 2> small;
+    small.EmplaceBack(2, 'x');
+    small.Emplace(small.begin(), "y");
+    assert(small[0] == "y" && small[1] == "xx");
+    cout << "Done!" << endl << endl;
+}
+
+void TestBulkInsert() {
+    cout << "Test bulk insert, append and assign" << endl;
+    {
+        const std::vector<int> source{ 10, 11, 12 };
+        SimpleVector<int> v(source.begin(), source.end());
+        assert((v == SimpleVector<int>{10, 11, 12}));
+
+        v.Append(source.begin(), source.end());
+        v.Insert(v.begin() + 1, 2u, 7);
+        v.Insert(v.begin(), source.begin(), source.begin() + 2);
+        assert((v == SimpleVector<int>{10, 11, 10, 7, 7, 11, 12, 10, 11, 12}));
+
+        v.Assign(source.rbegin(), source.rend());
+        assert((v == SimpleVector<int>{12, 11, 10}));
+    }
+    {
+        //             
+        const std::vector<std::string> source{ "x", "y", "z", "w" };
+        SimpleVector<std::string> v{ "a", "b", "c" };
+        v.Reserve(20);
+        v.Insert(v.begin() + 1, source.begin(), source.end());
+        assert((v == SimpleVector<std::string>{"a", "x", "y", "z", "w", "b", "c"}));
+        assert(v.GetCapacity() == 20);
+
+        v.Insert(v.end() - 1, 2u, "q");
+        v.Insert(v.begin() + 2, 15u, v[0]);
+        assert(v.GetSize() == 24 && v.GetCapacity() == 40);
+        assert(v[1] == "x" && v[2] == "a" && v[16] == "a" && v[17] == "y" && v[21] == "q" && v[23] == "c");
+    }
+    {
+        //  
+        std::istringstream input("1 2 3");
+        SimpleVector<int> v{ 0, 4 };
+        v.Insert(v.begin() + 1, std::istream_iterator<int>(input), std::istream_iterator<int>());
+        assert((v == SimpleVector<int>{0, 1, 2, 3, 4}));
+    }
+    cout << "Done!" << endl << endl;
+}
+
+void TestBatchErase() {
+    cout << "Test range erase, erase if and swap erase" << endl;
+    {
+        SimpleVector<int> v{ 0, 1, 2, 3, 4, 5, 6, 7 };
+        [[maybe_unused]] auto it = v.Erase(v.begin() + 2, v.begin() + 5);
+        assert(*it == 5);
+        assert((v == SimpleVector<int>{0, 1, 5, 6, 7}));
+
+        assert(EraseIf(v, [](int x) { return x % 2 == 1; }) == 3);
+        assert((v == SimpleVector<int>{0, 6}));
+
+        v.PushBack(9);
+        v.SwapErase(v.begin());
+        assert((v == SimpleVector<int>{9, 6}));
+        v.SwapErase(v.end() - 1);
+        assert((v == SimpleVector<int>{9}));
+    }
+    {
+        SimpleVector<std::string> v{ "a", "bb", "c", "dd", "e" };
+        v.Erase(v.begin(), v.begin() + 1);
+        assert(EraseIf(v, [](const std::string& s) { return s.size() == 2; }) == 2);
+        assert((v == SimpleVector<std::string>{"c", "e"}));
+
+        v.SwapErase(v.begin());
+        assert((v == SimpleVector<std::string>{"e"}));
+        v.Erase(v.begin(), v.end());
+        assert(v.IsEmpty());
+    }
+    cout << "Done!" << endl << endl;
+}
+
+void TestGrowthPolicy() {
+    cout << "Test growth policy and shrink to fit" << endl;
+    {
+        SimpleVector<int, std::allocator<int>, OneAndHalfGrowth> v;
+        size_t expected_capacity = 0;
+        for (int i = 0; i < 100; ++i) {
+            if (v.GetSize() == expected_capacity) {
+                expected_capacity += expected_capacity / 2 + 1;
+            }
+            v.PushBack(i);
+            assert(v.GetCapacity() == expected_capacity);
+        }
+    }
+    {
+        SimpleVector<int, std::allocator<int>, SizeClassGrowth<>> v;
+        v.PushBack(1);
+        assert(v.GetCapacity() == 4);
+        v.Resize(1500);
+        v.PushBack(2);
+        assert(v.GetCapacity() * sizeof(int) % 4096 == 0);
+    }
+    {
+        SimpleVector<std::string> v(Reserve(100));
+        v.PushBack("a");
+        v.PushBack("b");
+        v.ShrinkToFit();
+        assert(v.GetCapacity() == 2);
+        assert((v == SimpleVector<std::string>{"a", "b"}));
+
+        SimpleVector<int> numbers(Reserve(100));
+        numbers.PushBack(7);
+        numbers.ShrinkToFit();
+        assert(numbers.GetCapacity() == 1 && numbers[0] == 7);
+        numbers.Clear();
+        numbers.ShrinkToFit();
+        assert(numbers.GetCapacity() == 0 && numbers.begin() == nullptr);
+    }
+    cout << "Done!" << endl << endl;
+}
+
+void TestAlignedStorage() {
+    cout << "Test aligned storage" << endl;
+    AlignedSimpleVector<float, 64> v;
+    for (int i = 0; i < 100; ++i) {
+        v.PushBack(static_cast<float>(i));
+        assert(reinterpret_cast<std::uintptr_t>(v.begin()) % 64 == 0);
+    }
+    v.Insert(v.begin() + 1, 3u, 0.5f);
+    assert(reinterpret_cast<std::uintptr_t>(v.begin()) % 64 == 0);
+    assert(v[0] == 0.0f && v[3] == 0.5f && v[4] == 1.0f);
+
+    AlignedSimpleVector<std::string, 32> strings(3, "s");
+    assert(reinterpret_cast<std::uintptr_t>(strings.begin()) % 32 == 0);
+    cout << "Done!" << endl << endl;
+}
+
+template <typename Type>
+void CheckBulkKernels(size_t size) {
+    SimpleVector<Type> v(size);
+    for (size_t i = 0; i < size; ++i) {
+        v[i] = static_cast<Type>((i * 7) % 13);
+    }
+    std::vector<Type> reference(v.begin(), v.end());
+
+    for (int value = 0; value < 14; ++value) {
+        [[maybe_unused]] const Type needle = static_cast<Type>(value);
+        assert(Find(v, needle) - v.begin() == std::find(reference.begin(), reference.end(), needle) - reference.begin());
+        assert(Count(v, needle) == static_cast<size_t>(std::count(reference.begin(), reference.end(), needle)));
+        assert(Contains(v, needle) == (std::find(reference.begin(), reference.end(), needle) != reference.end()));
+    }
+    if (size > 0) {
+        [[maybe_unused]] const auto [min, max] = MinMax(v);
+        assert(min == *std::min_element(reference.begin(), reference.end()));
+        assert(max == *std::max_element(reference.begin(), reference.end()));
+    }
+    assert(Sum(v) == std::accumulate(reference.begin(), reference.end(), Type{}));
+
+    SimpleVector<Type> copy(v);
+    assert(copy == v && !(copy < v) && !(v < copy));
+    if (size > 0) {
+        copy[size - 1] = static_cast<Type>(copy[size - 1] + 1);
+        assert(copy != v && v < copy && copy > v);
+    }
+
+    Fill(v, static_cast<Type>(5));
+    assert(Count(v, static_cast<Type>(5)) == size);
+}
+
+void TestBulkKernels() {
+    cout << "Test vectorized bulk kernels" << endl;
+    for (size_t size : { 0, 1, 3, 15, 16, 17, 33, 64, 100, 1000 }) {
+        CheckBulkKernels<char>(size);
+        CheckBulkKernels<int16_t>(size);
+        CheckBulkKernels<int>(size);
+        CheckBulkKernels<uint32_t>(size);
+        CheckBulkKernels<int64_t>(size);
+        CheckBulkKernels<float>(size);
+        CheckBulkKernels<double>(size);
+    }
+
+    //        
+    assert((SimpleVector<int>{ -1, 5 } < SimpleVector<int>{ 1, 0 }));
+    assert((SimpleVector<int>{ 1, 2 } < SimpleVector<int>{ 1, 2, 0 }));
+
+    SimpleVector<int> filled(37, 9);
+    assert(Count(filled, 9) == 37);
+    cout << "Done!" << endl << endl;
+}
+
+void TestParallelAlgorithms() {
+    cout << "Test parallel algorithms" << endl;
+    ThreadPool pool(4);
+    const size_t size = 1000000;
+
+    SimpleVector<int> v(size);
+    ParallelForEach(v, [](int& x) { x = 1; }, pool);
+    assert(Count(v, 1) == size);
+
+    iota(v.begin(), v.end(), 0);
+    SimpleVector<int64_t> squares;
+    ParallelTransform(v, squares, [](int x) { return static_cast<int64_t>(x) * x; }, pool);
+    assert(squares.GetSize() == size && squares[1000] == 1000000);
+
+    [[maybe_unused]] const int64_t sum = ParallelReduce(v, int64_t{ 0 }, [](int64_t acc, int64_t x) { return acc + x; }, pool);
+    assert(sum == static_cast<int64_t>(size) * (size - 1) / 2);
+
+    //  :    
+    SimpleVector<std::string> words(10000, "a");
+    words[0] = "b";
+    const std::string joined = ParallelReduce(words, std::string(), std::plus<>(), pool);
+    assert(joined.size() == 10000 && joined.front() == 'b');
+
+    SimpleVector<uint32_t> keys(size);
+    uint32_t state = 12345;
+    for (uint32_t& key : keys) {
+        state = state * 1664525u + 1013904223u;
+        key = state;
+    }
+    std::vector<uint32_t> expected(keys.begin(), keys.end());
+    std::sort(expected.begin(), expected.end());
+    ParallelSort(keys, std::less<>(), pool);
+    assert(std::equal(keys.begin(), keys.end(), expected.begin(), expected.end()));
+
+    //     
+    try {
+        ParallelForEach(v, [](int x) {
+            if (x == 777777) {
+                throw std::runtime_error("stop");
+            }
+        }, pool);
+        assert(false);
+    }
+    catch (const std::runtime_error&) {
+    }
+
+    // ,      ,   Wait()
+    struct UnmovableTask {
+        UnmovableTask() = default;
+        UnmovableTask(const UnmovableTask&) = default;
+        UnmovableTask(UnmovableTask&&) {
+            throw std::length_error("move");
+        }
+        void operator()() const {
+        }
+    };
+    TaskGroup group(pool);
+    const UnmovableTask task;
+    try {
+        group.Run(task);
+        assert(false);
+    }
+    catch (const std::length_error&) {
+    }
+    group.Wait();
+
+    //        
+    ThreadPool single(0);
+    SimpleVector<int> ones(1000);
+    ParallelForEach(ones, [](int& x) { x = 1; }, single);
+    assert(Count(ones, 1) == 1000);
+    cout << "Done!" << endl << endl;
+}
+
+void TestConcurrentSimpleVector() {
+    cout << "Test concurrent append" << endl;
+    ConcurrentSimpleVector<size_t, 4> v;
+    const size_t threads = 4;
+    const size_t per_thread = 20000;
+    const size_t total = threads * per_thread;
+    //      ,     
+    v.PushBack(total);
+    [[maybe_unused]] const size_t* first = &v[0];
+
+    std::vector<std::thread> writers;
+    for (size_t t = 0; t < threads; ++t) {
+        writers.emplace_back([&v, t, per_thread] {
+            for (size_t i = 0; i < per_thread; ++i) {
+                v.PushBack(t * per_thread + i);
+            }
+        });
+    }
+    //      
+    while (v.GetSize() <= total) {
+        assert(v[0] == total);
+        assert(v[v.GetSize() - 1] <= total);
+    }
+    for (std::thread& writer : writers) {
+        writer.join();
+    }
+
+    //      
+    assert(first == &v[0]);
+    assert(v.GetSize() == total + 1);
+    std::vector<size_t> values(v.begin(), v.end());
+    std::sort(values.begin(), values.end());
+    for (size_t i = 0; i <= total; ++i) {
+        assert(values[i] == i);
+    }
+
+    ConcurrentSimpleVector<std::string> words;
+    words.Reserve(100);
+    assert(words.GetCapacity() >= 100);
+    assert(words.EmplaceBack(3, 'a') == 0);
+    assert(words.At(0) == "aaa");
+    try {
+        words.At(1);
+        assert(false);
+    }
+    catch (const std::out_of_range&) {
+    }
+
+    // ,  ,      
+    struct Picky {
+        explicit Picky(int value) : value(value) {
+            if (value < 0) {
+                throw std::invalid_argument("negative");
+            }
+        }
+        int value;
+    };
+    ConcurrentSimpleVector<Picky> picky;
+    picky.EmplaceBack(1);
+    try {
+        picky.EmplaceBack(-1);
+        assert(false);
+    }
+    catch (const std::invalid_argument&) {
+    }
+    assert(picky.EmplaceBack(2) == 1 && picky.GetSize() == 2);
+    assert(picky[1].value == 2 && (picky.end() - 1)->value == 2);
+    assert(1 + picky.begin() == picky.end() - 1 && picky.end() > picky.begin() && picky.begin() <= picky.begin());
+
+    words.Clear();
+    assert(words.IsEmpty());
+    cout << "Done!" << endl << endl;
+}
+
+void TestSegmentedVector() {
+    cout << "Test segmented vector" << endl;
+    SegmentedVector<int, 64> v;
+    v.PushBack(0);
+    [[maybe_unused]] const int* first = &v[0];
+    for (int i = 1; i < 10000; ++i) {
+        v.PushBack(i);
+    }
+    //   ,   
+    assert(first == &v[0]);
+    assert(v.GetSize() == 10000 && v.GetCapacity() == 10048);
+    assert(v.At(9999) == 9999);
+    try {
+        v.At(10000);
+        assert(false);
+    }
+    catch (const std::out_of_range&) {
+    }
+
+    //   
+    assert(v.end() - v.begin() == 10000);
+    assert(*(v.begin() + 130) == 130 && v.begin()[64] == 64);
+    std::sort(v.begin(), v.end(), std::greater<>());
+    assert(v[0] == 9999 && v[9999] == 0);
+    assert(std::is_sorted(v.cbegin(), v.cend(), std::greater<>()));
+
+    v.Resize(100);
+    assert(v.GetSize() == 100 && v[99] == 9900);
+    v.ShrinkToFit();
+    assert(v.GetCapacity() == 128);
+    v.Resize(200);
+    assert(v[150] == 0);
+
+    SegmentedVector<std::string, 4> words{ "a", "b", "c", "d", "e" };
+    words.EmplaceBack(words[0]);
+    SegmentedVector<std::string, 4> copy = words;
+    assert(copy == words && copy[5] == "a");
+    SegmentedVector<std::string, 4> moved = std::move(copy);
+    assert(copy.IsEmpty() && moved == words);
+    moved.PopBack();
+    assert(moved < words);
+
+    SegmentedVector<X, 8> noncopiable;
+    for (size_t i = 0; i < 20; ++i) {
+        noncopiable.PushBack(X(i));
+    }
+    assert(noncopiable[19].GetX() == 19);
+    cout << "Done!" << endl << endl;
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+void TestMappedSimpleVector() {
+    cout << "Test mapped vector" << endl;
+    const std::string path = "mapped_vector_test.bin";
+    std::remove(path.c_str());
+    {
+        MappedSimpleVector<uint64_t> v(path);
+        assert(v.IsOpen() && v.IsEmpty());
+        for (uint64_t i = 0; i < 100000; ++i) {
+            v.PushBack(i * 3);
+        }
+        v.PushBack(v[0]);
+        v.Advise(MappedSimpleVector<uint64_t>::Advice::SEQUENTIAL);
+        v.Sync();
+    }
+    {
+        //      
+        MappedSimpleVector<uint64_t> v(path);
+        assert(v.GetSize() == 100001 && v[99999] == 299997 && v.At(100000) == 0);
+        v.Resize(10);
+        v.ShrinkToFit();
+        assert(v.GetCapacity() == 10);
+        v.Resize(20);
+        assert(v[9] == 27 && v[19] == 0);
+        MappedSimpleVector<uint64_t> moved = std::move(v);
+        assert(!v.IsOpen() && moved.GetSize() == 20);
+        //   ,     
+        v.Clear();
+        assert(v.IsEmpty() && v.GetCapacity() == 0 && v.begin() == v.end());
+    }
+    try {
+        MappedSimpleVector<uint32_t> wrong_type(path);
+        assert(false);
+    }
+    catch (const std::runtime_error&) {
+    }
+    std::remove(path.c_str());
+    cout << "Done!" << endl << endl;
+}
+#endif
+
+void TestSerialization() {
+    cout << "Test serialization" << endl;
+    SimpleVector<int> numbers(100000);
+    iota(numbers.begin(), numbers.end(), -500);
+    std::stringstream stream;
+    Save(numbers, stream);
+    assert(stream.str().size() == sizeof(SerializedHeader) + numbers.GetSize() * sizeof(int));
+
+    SimpleVector<int> loaded{ 1, 2, 3 };
+    Load(loaded, stream);
+    assert(loaded == numbers);
+
+    //       
+    stream.clear();
+    stream.seekg(0);
+    SimpleVectorReader<int> reader(stream);
+    SimpleVector<int> chunked;
+    while (!reader.IsDone()) {
+        assert(reader.ReadChunk(chunked, 4096) > 0);
+    }
+    assert(chunked == numbers);
+
+    SimpleVector<std::string> words{ "alpha", "", "gamma" };
+    std::stringstream words_stream;
+    Save(words, words_stream);
+    SimpleVector<std::string> loaded_words;
+    Load(loaded_words, words_stream);
+    assert(loaded_words == words);
+
+    //       ,   
+    std::string corrupted = stream.str();
+    corrupted[sizeof(SerializedHeader) + 10] ^= 1;
+    std::stringstream corrupted_stream(corrupted);
+    try {
+        Load(loaded, corrupted_stream);
+        assert(false);
+    }
+    catch (const std::runtime_error&) {
+    }
+    assert(loaded == numbers);
+
+    std::stringstream wrong_stream(stream.str());
+    SimpleVector<int64_t> wrong_type;
+    try {
+        Load(wrong_type, wrong_stream);
+        assert(false);
+    }
+    catch (const std::runtime_error&) {
+    }
+
+    //           
+    std::string truncated = stream.str();
+    SerializedHeader header;
+    std::memcpy(&header, truncated.data(), sizeof(header));
+    header.count = uint64_t{ 1 } << 60;
+    std::memcpy(truncated.data(), &header, sizeof(header));
+    std::stringstream truncated_stream(truncated);
+    try {
+        Load(loaded, truncated_stream);
+        assert(false);
+    }
+    catch (const std::runtime_error&) {
+    }
+    assert(loaded == numbers);
+
+    //          ,    
+    struct NoSeekBuf : std::stringbuf {
+        using std::stringbuf::stringbuf;
+        pos_type seekoff(off_type, std::ios::seekdir, std::ios::openmode) override {
+            return pos_type(off_type(-1));
+        }
+    } no_seek(truncated);
+    std::istream pipe_like(&no_seek);
+    try {
+        Load(loaded, pipe_like);
+        assert(false);
+    }
+    catch (const std::runtime_error&) {
+    }
+    assert(loaded == numbers);
+
+#ifdef SIMPLE_VECTOR_POSIX_IO
+    //    ,        
+    try {
+        Save(numbers, -1);
+        assert(false);
+    }
+    catch (const std::invalid_argument&) {
+    }
+    try {
+        Load(loaded, -1);
+        assert(false);
+    }
+    catch (const std::invalid_argument&) {
+    }
+    assert(loaded == numbers);
+#endif
+    cout << "Done!" << endl << endl;
+}
+
+void TestLargeBuffers() {
+    cout << "Test large buffers" << endl;
+    // 16      
+    LargeSimpleVector<int> v(size_t{ 1 } << 22);
+    assert(v[0] == 0 && v[v.GetSize() - 1] == 0);
+    assert(Count(v, 0) == v.GetSize());
+    v[12345] = 7;
+    v.PushBack(42);
+    assert(v[12345] == 7 && v[v.GetSize() - 1] == 42);
+    v.ShrinkToFit();
+    assert(v.GetCapacity() == v.GetSize() && v[12345] == 7);
+
+    //   :      mmap  
+    SimpleVector<int, LargeBufferAllocator<int, 256>> crossing;
+    for (int i = 0; i < 1000; ++i) {
+        crossing.PushBack(i);
+    }
+    assert(crossing[999] == 999 && crossing[63] == 63);
+    crossing.Resize(10);
+    crossing.ShrinkToFit();
+    assert(crossing.GetCapacity() == 10 && crossing[9] == 9);
+
+    SimpleVector<double, LargeBufferAllocator<double, 256>> resized;
+    resized.Resize(1000);
+    assert(resized[999] == 0.0);
+    cout << "Done!" << endl << endl;
+}
+
+struct StatsSample {
+    int value;
+};
+
+size_t stats_events = 0;
+
+void TestStatistics() {
+    cout << "Test statistics" << endl;
+    //  SIMPLE_VECTOR_STATS    ,     
+    [[maybe_unused]] const auto expect = [](size_t value) {
+        return stats::kEnabled ? value : 0;
+    };
+    stats::Counters& counters = stats::ForType<StatsSample>();
+    counters.Reset();
+    stats::SetCallback([](const stats::Event& event) {
+        if (event.type == typeid(StatsSample)) {
+            ++stats_events;
+        }
+    });
+    {
+        SimpleVector<StatsSample> v;
+        for (int i = 0; i < 100; ++i) {
+            v.PushBack({ i });
+        }
+        //  1, 2, 4, ..., 128:  ,    -   
+        assert(counters.allocations == expect(8));
+        assert(counters.reallocations == expect(7));
+        assert(counters.moved_by_growth == expect(1 + 2 + 4 + 8 + 16 + 32 + 64));
+        assert(counters.bytes_allocated == expect(255 * sizeof(StatsSample)));
+        assert(counters.peak_size == expect(100) && counters.peak_capacity == expect(128));
+
+        v.Insert(v.begin() + 90, StatsSample{ -1 });
+        assert(counters.insert_shifted == expect(10));
+        v.Erase(v.begin());
+        v.Erase(v.begin() + 50, v.end());
+        assert(counters.erase_shifted == expect(100 + 0));
+    }
+    stats::SetCallback(nullptr);
+    assert(stats_events == expect(8 + 7 + 1 + 1));
+
+    bool found = false;
+    stats::ForEachType([&found](const std::type_info& type, const stats::Counters& type_counters) {
+        if (type == typeid(StatsSample)) {
+            found = type_counters.allocations == 8;
+        }
+    });
+    assert(found == stats::kEnabled);
+    assert(stats::Global().allocations >= counters.allocations);
+    cout << "Done!" << endl << endl;
+}
+
+//    ,      
+size_t check_failures = 0;
+
+struct CountingPolicy {
+    static constexpr bool kCheckedIterators = true;
+
+    static void Check(bool condition, const char*) noexcept {
+        if (!condition) {
+            ++check_failures;
+        }
+    }
+};
+
+void TestCheckPolicy() {
+    cout << "Test check policy" << endl;
+    //          
+    static_assert(sizeof(SimpleVector<int, std::allocator<int>, DoublingGrowth, UncheckedPolicy>) == sizeof(SimpleVector<int>));
+    static_assert(std::is_same_v<SimpleVector<int, std::allocator<int>, DoublingGrowth, HardenedPolicy>::Iterator, int*>);
+
+    SimpleVector<int, std::allocator<int>, DoublingGrowth, HardenedPolicy> hardened{ 1, 2, 3 };
+    hardened.Insert(hardened.begin() + 1, 5);
+    hardened.Erase(hardened.begin());
+    assert(hardened[0] == 5 && hardened.GetSize() == 3);
+
+    SimpleVector<int, std::allocator<int>, DoublingGrowth, DebugPolicy> debug;
+    for (int i = 0; i < 10; ++i) {
+        debug.Insert(debug.begin(), i);
+    }
+    EraseIf(debug, [](int value) { return value % 2 == 0; });
+    std::sort(debug.begin(), debug.end());
+    assert(debug.GetSize() == 5 && debug[0] == 1 && *(debug.end() - 1) == 9);
+    assert(Find(debug, 7) - debug.begin() == 3 && Sum(debug) == 25);
+
+    SimpleVector<int, std::allocator<int>, DoublingGrowth, CountingPolicy> counted{ 1, 2, 3 };
+    auto it = counted.begin() + 1;
+    assert(*it == 2 && check_failures == 0);
+    counted.Reserve(counted.GetCapacity());
+    it.Get();
+    assert(check_failures == 0);
+    //       
+    counted.Reserve(100);
+    it.Get();
+    assert(check_failures > 0);
+    check_failures = 0;
+    it = counted.begin() + 1;
+    assert(*it == 2 && check_failures == 0);
+    counted[3];
+    assert(check_failures == 1);
+    cout << "Done!" << endl << endl;
+}
+
+void TestSoaVector() {
+    cout << "Test structure of arrays" << endl;
+    SoaVector<int, double, string> soa;
+    for (int i = 0; i < 100; ++i) {
+        soa.PushBack(i, i * 0.5, to_string(i));
+    }
+    assert(soa.GetSize() == 100 && soa.GetCapacity() >= 100);
+
+    //   -    
+    [[maybe_unused]] auto ids = soa.Column<0>();
+    [[maybe_unused]] auto prices = soa.Column<1>();
+    assert(ids.GetSize() == 100 && prices.Data() + 99 == &prices[99]);
+    assert(accumulate(ids.begin(), ids.end(), 0) == 4950);
+    assert(get<2>(soa[42]) == "42"s);
+
+    double total = 0.0;
+    for (auto [id, price, name] : soa) {
+        assert(price == id * 0.5 && name == to_string(id));
+        total += price;
+    }
+    assert(total == 2475.0);
+
+    for (auto row : soa) {
+        get<1>(row) *= 2;
+    }
+    assert(get<1>(soa[10]) == 10.0);
+
+    const SoaVector<int, double, string> copy(soa);
+    soa.Resize(10);
+    assert(soa.GetSize() == 10 && copy.GetSize() == 100);
+    assert(get<2>(copy.At(99)) == "99"s && copy.end() - copy.begin() == 100);
+    soa.Resize(12);
+    assert(get<0>(soa[11]) == 0 && get<2>(soa[11]).empty());
+    soa.PopBack();
+    assert(soa.GetSize() == 11);
+
+    SoaVector<int, double, string> moved(std::move(soa));
+    assert(moved.GetSize() == 11 && soa.IsEmpty());
+    try {
+        moved.At(11);
+        assert(false);
+    }
+    catch (const out_of_range&) {
+    }
+
+    //        
+    SoaVector<int, string> self;
+    self.PushBack(7, string(40, 'a'));
+    while (self.GetSize() < self.GetCapacity()) {
+        self.PushBack(0, ""s);
+    }
+    self.PushBack(self.Column<0>()[0], self.Column<1>()[0]);
+    assert(get<0>(self[self.GetSize() - 1]) == 7 && get<1>(self[self.GetSize() - 1]) == string(40, 'a'));
+
+    //          
+    SoaVector<int, Handle> handles;
+    for (int i = 0; i < 50; ++i) {
+        handles.PushBack(i, Handle(i));
+    }
+    assert(handles.GetSize() == 50 && get<1>(handles[49]).GetValue() == 49 && get<1>(handles[0]).GetValue() == 0);
+    handles.PopBack();
+    handles.Clear();
+    cout << "Done!" << endl << endl;
+}
+
+void TestSharedSimpleVector() {
+    cout << "Test copy-on-write vector" << endl;
+    SharedSimpleVector<int> config(1000, 7);
+    [[maybe_unused]] const int* data = &std::as_const(config)[0];
+
+    //   ,    
+    vector<SharedSimpleVector<int>> workers(200, config);
+    assert(config.GetUseCount() == 201 && config.IsShared());
+    assert(&std::as_const(workers[199])[0] == data && workers[0] == config);
+
+    //       
+    workers[0].PushBack(8);
+    assert(workers[0].GetSize() == 1001 && !workers[0].IsShared());
+    assert(config.GetSize() == 1000 && config.GetUseCount() == 200);
+    workers[1][0] = 1;
+    assert(std::as_const(config)[0] == 7 && &std::as_const(workers[2])[0] == data);
+    workers[2].Erase(workers[2].cbegin());
+    workers[3].Insert(workers[3].cbegin() + 10, 5);
+    assert(workers[2].GetSize() == 999 && workers[3].At(10) == 5 && std::as_const(config).At(10) == 7);
+    workers[4].Clear();
+    assert(workers[4].IsEmpty() && config.GetUseCount() == 196);
+
+    //        
+    vector<thread> threads;
+    for (size_t t = 0; t < 4; ++t) {
+        threads.emplace_back([&workers, t] {
+            for (size_t i = 10 + t; i < workers.size(); i += 4) {
+                assert(Sum(workers[i].AsVector()) == 7000);
+                workers[i][static_cast<size_t>(t)] = 0;
+            }
+        });
+    }
+    for (thread& thread : threads) {
+        thread.join();
+    }
+    workers.clear();
+    assert(config.GetUseCount() == 1 && !config.IsShared());
+    config[0] = 9;
+    assert(&std::as_const(config)[0] == data);
+
+    SharedSimpleVector<int> empty;
+    assert(empty.IsEmpty() && empty.begin() == empty.end());
+    empty.PushBack(1);
+    assert(empty.GetSize() == 1 && empty != config);
+
+    // ,    ,      
+    SharedSimpleVector<int> original{ 1, 2, 3 };
+    int& first = original[0];
+    auto it = original.begin() + 1;
+    SharedSimpleVector<int> snapshot = original;
+    assert(!original.IsShared() && !snapshot.IsShared());
+    first = 42;
+    *it = 43;
+    assert(std::as_const(snapshot)[0] == 1 && std::as_const(snapshot)[1] == 2 && std::as_const(original)[0] == 42);
+    //     ,     
+    original.Clear();
+    original.PushBack(5);
+    SharedSimpleVector<int> shared = original;
+    assert(original.IsShared() && shared.GetUseCount() == 2);
+    cout << "Done!" << endl << endl;
+}
+
+void TestPersistentVector() {
+    cout << "Test persistent vector" << endl;
+    // 40000  -      
+    TransientVector<string> transient;
+    for (int i = 0; i < 40000; ++i) {
+        transient.PushBack(to_string(i));
+    }
+    const PersistentVector<string> base = transient.Persistent();
+    assert(base.GetSize() == 40000 && transient.IsEmpty());
+    assert(base[0] == "0"s && base[1055] == "1055"s && base.At(39999) == "39999"s);
+
+    //          
+    PersistentVector<string> changed = base.Set(1055, "x"s).PushBack("tail"s);
+    assert(changed[1055] == "x"s && base[1055] == "1055"s);
+    assert(changed.GetSize() == 40001 && base.GetSize() == 40000);
+
+    //          
+    vector<PersistentVector<string>> versions{ base };
+    PersistentVector<string> shrinking = base;
+    while (!shrinking.IsEmpty()) {
+        shrinking = shrinking.PopBack();
+        const size_t size = shrinking.GetSize();
+        if (size % 1000 == 0) {
+            assert(size == 0 || shrinking[size - 1] == to_string(size - 1));
+            versions.push_back(shrinking);
+        }
+    }
+    assert(base.GetSize() == 40000 && base[39999] == "39999"s);
+    assert(versions[1].GetSize() == 39000 && versions.back().IsEmpty());
+
+    size_t index = 0;
+    for ([[maybe_unused]] const string& item : base) {
+        assert(item == to_string(index++));
+    }
+    assert(index == 40000 && *(base.begin() + 1055) == "1055"s && base.end() - base.begin() == 40000);
+
+    //     end(),     ;    
+    const PersistentVector<string> small = PersistentVector<string>().PushBack("a"s).PushBack("b"s).PushBack("c"s);
+    assert(*--small.end() == "c"s && *prev(small.end()) == "c"s);
+    const vector<string> small_reversed(make_reverse_iterator(small.end()), make_reverse_iterator(small.begin()));
+    assert((small_reversed == vector<string>{ "c"s, "b"s, "a"s }));
+    index = changed.GetSize();
+    for (auto it = make_reverse_iterator(changed.end()); it != make_reverse_iterator(changed.begin()); ++it) {
+        --index;
+        assert(*it == (index == 40000 ? "tail"s : index == 1055 ? "x"s : to_string(index)));
+    }
+    assert(index == 0);
+
+    //         ,   
+    TransientVector<string> batch = changed.Transient();
+    for (size_t i = 0; i < 40001; i += 7) {
+        batch.Set(i, "b"s);
+    }
+    batch.PopBack();
+    batch.EmplaceBack(3, 'z');
+    const PersistentVector<string> edited = batch.Persistent();
+    assert(edited[7] == "b"s && edited[40000] == "zzz"s && changed[7] == "7"s && changed[40000] == "tail"s);
+
+    //    ,     
+    PersistentVector<int> numbers;
+    vector<PersistentVector<int>> snapshots;
+    for (int i = 0; i < 2000; ++i) {
+        numbers = numbers.PushBack(i);
+        if (i % 100 == 0) {
+            snapshots.push_back(numbers);
+        }
+    }
+    vector<thread> readers;
+    for (const PersistentVector<int>& snapshot : snapshots) {
+        readers.emplace_back([snapshot] {
+            assert(accumulate(snapshot.begin(), snapshot.end(), size_t{ 0 }) == snapshot.GetSize() * (snapshot.GetSize() - 1) / 2);
+        });
+    }
+    for (int i = 0; i < 2000; ++i) {
+        numbers = numbers.Set(i, -i);
+    }
+    for (thread& reader : readers) {
+        reader.join();
+    }
+    assert(numbers[1999] == -1999 && snapshots.back()[1999 - 99] == 1900);
+    assert(PersistentVector<int>({ 1, 2, 3 }) == PersistentVector<int>({ 1, 2, 3 }));
+    cout << "Done!" << endl << endl;
+}
+
+template <typename Type, typename Make>
+void TestGapEditing(Make make) {
+    //       std::vector
+    GapVector<Type> text;
+    vector<Type> model;
+    size_t cursor = 0;
+    uint32_t seed = 7;
+    for (int step = 0; step < 5000; ++step) {
+        seed = seed * 1103515245u + 12345u;
+        const uint32_t action = (seed >> 16) % 10;
+        if (action < 6 || model.empty()) {
+            text.Insert(text.cbegin() + cursor, make(step));
+            model.insert(model.begin() + cursor, make(step));
+            ++cursor;
+        }
+        else if (action < 8) {
+            cursor = cursor > 0 ? cursor - 1 : 0;
+            if (cursor < model.size()) {
+                text.Erase(text.cbegin() + cursor);
+                model.erase(model.begin() + cursor);
+            }
+        }
+        else {
+            //   :      
+            cursor = min(model.size(), cursor + (seed >> 20) % 16);
+            cursor = cursor > 8 ? cursor - 8 : 0;
+        }
+        assert(text.GetSize() == model.size());
+    }
+    assert(equal(text.begin(), text.end(), model.begin(), model.end()));
+    [[maybe_unused]] const auto* flat = text.AsContiguous();
+    assert(equal(flat, flat + text.GetSize(), model.begin()) && text.GetGapPosition() == text.GetSize());
+}
+
+void TestGapVector() {
+    cout << "Test gap vector" << endl;
+    TestGapEditing<char>([](int step) { return static_cast<char>('a' + step % 26); });
+    TestGapEditing<string>([](int step) { return to_string(step); });
+
+    GapVector<string> lines{ "a"s, "b"s, "e"s };
+    vector<string> middle{ "c"s, "d"s };
+    lines.Insert(lines.cbegin() + 2, middle.begin(), middle.end());
+    assert(lines.GetSize() == 5 && lines[2] == "c"s && lines[4] == "e"s && lines.GetGapPosition() == 4);
+    lines.Insert(lines.cbegin(), lines[4]);
+    lines.Erase(lines.cbegin() + 1, lines.cbegin() + 3);
+    assert(lines == GapVector<string>({ "e"s, "c"s, "d"s, "e"s }));
+    sort(lines.begin(), lines.end());
+    assert(lines.At(0) == "c"s && *(lines.end() - 1) == "e"s);
+
+    GapVector<string> copy(lines);
+    lines.PopBack();
+    lines.Clear();
+    assert(lines.IsEmpty() && copy.GetSize() == 4);
+    GapVector<int> numbers(5);
+    numbers.EmplaceBack(7);
+    assert(numbers[0] == 0 && numbers[5] == 7);
+    cout << "Done!" << endl << endl;
+}
+
+//  FlatSet  std::set     
+template <typename Layout>
+void TestFlatSetLayout() {
+    FlatSet<int, less<int>, Layout> keys;
+    set<int> expected;
+    for (int step = 0; step < 300; ++step) {
+        [[maybe_unused]] const int key = step * 7919 % 500;
+        assert(keys.Insert(key).second == expected.insert(key).second);
+    }
+    vector<int> batch;
+    for (int step = 0; step < 1000; ++step) {
+        batch.push_back(step * 104729 % 1500);
+    }
+    [[maybe_unused]] const size_t inserted = keys.InsertBatch(batch);
+    [[maybe_unused]] const size_t old_size = expected.size();
+    expected.insert(batch.begin(), batch.end());
+    assert(inserted == expected.size() - old_size);
+    assert(equal(keys.begin(), keys.end(), expected.begin(), expected.end()));
+
+    for (int key = -1; key <= 1501; ++key) {
+        [[maybe_unused]] const auto it = keys.LowerBound(key);
+        [[maybe_unused]] const auto expected_it = expected.lower_bound(key);
+        assert((it == keys.end()) == (expected_it == expected.end()));
+        assert(it == keys.end() || *it == *expected_it);
+        assert(keys.Contains(key) == (expected.count(key) == 1));
+    }
+    for (int key = 0; key < 1500; key += 3) {
+        assert(keys.Erase(key) == expected.erase(key));
+    }
+    assert(equal(keys.begin(), keys.end(), expected.begin(), expected.end()));
+    assert(keys.Find(3) == keys.end() && *keys.UpperBound(4) == *expected.upper_bound(4));
+    keys.Clear();
+    assert(keys.IsEmpty() && keys.Find(1) == keys.end());
+}
+
+// ,      
+bool flat_key_copy_throws = false;
+
+struct FlatKey {
+    explicit FlatKey(int value) : value(value) {
+    }
+    FlatKey(const FlatKey& other) : value(other.value) {
+        if (flat_key_copy_throws) {
+            throw std::bad_alloc();
+        }
+    }
+    //   ,       
+    FlatKey(FlatKey&& other) noexcept : value(std::exchange(other.value, -1)) {
+    }
+    FlatKey& operator=(const FlatKey&) = default;
+    FlatKey& operator=(FlatKey&& other) noexcept {
+        value = std::exchange(other.value, -1);
+        return *this;
+    }
+
+    friend bool operator<(const FlatKey& lhs, const FlatKey& rhs) {
+        return lhs.value < rhs.value;
+    }
+
+    int value;
+};
+
+void TestFlatContainers() {
+    cout << "Test flat containers" << endl;
+    TestFlatSetLayout<SortedLayout>();
+    TestFlatSetLayout<EytzingerLayout>();
+
+    FlatSet<string, greater<string>> words{ "b"s, "a"s, "c"s, "a"s };
+    assert(words.GetSize() == 3 && *words.begin() == "c"s);
+    assert((words == FlatSet<string, greater<string>>{ "a"s, "c"s, "b"s }));
+
+    FlatMap<string, int, less<string>, EytzingerLayout> counts{ { "x"s, 1 }, { "y"s, 2 }, { "x"s, 3 } };
+    assert(counts.GetSize() == 2 && counts.At("x"s) == 1);
+    ++counts["z"s];
+    counts["y"s] += 10;
+    assert(!counts.Insert("z"s, 5).second && counts.At("z"s) == 1);
+    counts.InsertOrAssign("x"s, 7);
+    vector<pair<string, int>> batch{ { "w"s, 4 }, { "y"s, 0 }, { "a"s, 9 } };
+    assert(counts.InsertBatch(batch) == 2);
+
+    int sum = 0;
+    for (const auto [key, value] : counts) {
+        sum += value;
+    }
+    assert(sum == 9 + 4 + 7 + 12 + 1);
+    for (auto [key, value] : counts) {
+        value *= 2;
+    }
+    assert(counts.GetKeys() == SimpleVector<string>({ "a"s, "w"s, "x"s, "y"s, "z"s }));
+    assert(counts.GetValues() == SimpleVector<int>({ 18, 8, 14, 24, 2 }));
+    assert(counts.Erase("w"s) == 1 && counts.Erase("w"s) == 0 && !counts.Contains("w"s));
+    assert((*counts.Find("y"s)).second == 24 && counts.Find("q"s) == counts.end());
+    try {
+        counts.At("q"s);
+        assert(false);
+    }
+    catch (const out_of_range&) {
+    }
+
+    //         
+    FlatSet<FlatKey, less<FlatKey>, EytzingerLayout> guarded;
+    FlatMap<FlatKey, int, less<FlatKey>, EytzingerLayout> guarded_map;
+    for (int i = 0; i < 20; i += 2) {
+        guarded.Insert(FlatKey(i));
+        guarded_map.Insert(FlatKey(i), i);
+    }
+    //   ,       
+    vector<FlatKey> key_batch;
+    vector<pair<FlatKey, int>> row_batch;
+    for (int i = 1; i < 20; i += 6) {
+        key_batch.emplace_back(i);
+        row_batch.emplace_back(FlatKey(i), i);
+    }
+    flat_key_copy_throws = true;
+    const auto expect_bad_alloc = [](auto action) {
+        try {
+            action();
+            assert(false);
+        }
+        catch (const bad_alloc&) {
+        }
+    };
+    expect_bad_alloc([&] { guarded.Insert(FlatKey(5)); });
+    expect_bad_alloc([&] { guarded.Erase(FlatKey(4)); });
+    expect_bad_alloc([&] { guarded_map.Erase(FlatKey(4)); });
+    expect_bad_alloc([&] { guarded_map.TryEmplace(FlatKey(7), 7); });
+    expect_bad_alloc([&] { guarded.InsertBatch(make_move_iterator(key_batch.begin()), make_move_iterator(key_batch.end())); });
+    expect_bad_alloc([&] { guarded_map.InsertBatch(make_move_iterator(row_batch.begin()), make_move_iterator(row_batch.end())); });
+    flat_key_copy_throws = false;
+    assert(guarded.GetSize() == 10 && guarded_map.GetSize() == 10);
+    for (int i = 0; i < 20; ++i) {
+        assert(guarded.Contains(FlatKey(i)) == (i % 2 == 0));
+        assert(guarded_map.Contains(FlatKey(i)) == (i % 2 == 0));
+    }
+    assert(guarded.begin()->value == 0 && guarded_map.GetKeys()[9].value == 18 && guarded_map.At(FlatKey(18)) == 18);
+
+    const FlatMap<string, int, less<string>, EytzingerLayout> snapshot(counts);
+    counts.Clear();
+    assert(counts.IsEmpty() && snapshot.GetSize() == 4 && snapshot.At("a"s) == 18);
+    cout << "Done!" << endl << endl;
+}
+
+void TestBitVector() {
+    cout << "Test bit vector" << endl;
+    BitVector bits;
+    vector<bool> expected;
+    for (int step = 0; step < 300; ++step) {
+        const bool value = step * 7919 % 5 < 2;
+        bits.PushBack(value);
+        expected.push_back(value);
+    }
+    assert(bits.GetSize() == 300 && bits.GetWords().GetSize() == 5);
+    assert(equal(bits.begin(), bits.end(), expected.begin(), expected.end()));
+    assert(bits.Count() == static_cast<size_t>(count(expected.begin(), expected.end(), true)));
+
+    vector<size_t> positions;
+    for (size_t pos = bits.FindFirst(); pos != bits.GetSize(); pos = bits.FindNext(pos)) {
+        positions.push_back(pos);
+    }
+    vector<size_t> expected_positions;
+    for (size_t pos = 0; pos < expected.size(); ++pos) {
+        if (expected[pos]) {
+            expected_positions.push_back(pos);
+        }
+    }
+    assert(positions == expected_positions);
+
+    // -  
+    bits[0] = true;
+    bits[1] = bits[0];
+    bits[2].Flip();
+    *(bits.begin() + 3) = false;
+    assert(bits[0] && bits[1] && bits[2] == !expected[2] && !bits.At(3));
+    for (auto bit : bits) {
+        bit = true;
+    }
+    assert(bits.All() && bits.Count() == 300);
+    try {
+        bits.At(300);
+        assert(false);
+    }
+    catch (const out_of_range&) {
+    }
+
+    //       Resize, PopBack  Not
+    bits.Resize(130);
+    assert(bits.Count() == 130);
+    bits.Resize(200, false);
+    assert(bits.Count() == 130 && bits.FindNext(129) == 200);
+    bits.Resize(250, true);
+    assert(bits.Count() == 180 && !bits[199] && bits[200] && bits[249]);
+    bits.PopBack();
+    bits.Not();
+    assert(bits.GetSize() == 249 && bits.Count() == 70 && bits.FindFirst() == 130);
+
+    BitVector mask(249, true);
+    mask[130] = false;
+    BitVector both(bits);
+    both.And(mask);
+    assert(both.Count() == 69 && both.FindFirst() == 131);
+    both.Or(bits).Xor(bits);
+    assert(both.None() && !both.Any());
+    assert((both |= mask) == mask && both != bits);
+
+    const BitVector flags{ true, false, true };
+    assert(flags.GetSize() == 3 && flags[2] && *flags.cbegin() && flags.Count() == 2);
+    BitVector empty(Reserve(1000));
+    assert(empty.IsEmpty() && empty.GetCapacity() >= 1000 && empty.FindFirst() == 0);
+    swap(empty, both);
+    both.Clear();
+    assert(both.IsEmpty() && empty == mask);
+    cout << "Done!" << endl << endl;
+}
+
 int main() {
     TestTemporaryObjConstructor();
     TestTemporaryObjOperator();
@@ -209,6 +1598,33 @@ int main() {
     
     TestNoncopiableErase();
 
+    TestRawStorage();
+    TestPmrAllocator();
+    TestTriviallyRelocatable();
+    TestSmallSimpleVector();
+    TestEmplace();
+    TestBulkInsert();
+    TestBatchErase();
+    TestGrowthPolicy();
+    TestAlignedStorage();
+    TestBulkKernels();
+    TestParallelAlgorithms();
+    TestConcurrentSimpleVector();
+    TestSegmentedVector();
+#if defined(__unix__) || defined(__APPLE__)
+    TestMappedSimpleVector();
+#endif
+    TestSerialization();
+    TestLargeBuffers();
+    TestStatistics();
+    TestCheckPolicy();
+    TestSoaVector();
+    TestSharedSimpleVector();
+    TestPersistentVector();
+    TestGapVector();
+    TestFlatContainers();
+    TestBitVector();
+
     //   9 
     Test1();
     Test2();
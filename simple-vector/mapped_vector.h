@@ -0,0 +1,345 @@
+#pragma once
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <algorithm>
+#include <cassert>
+#include <cerrno>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "growth_policy.h"
+
+// ,    ,   .     ,
+//         :     
+//    page cache   ,    .
+//           
+template <typename Type, typename GrowthPolicy = DoublingGrowth>
+class MappedSimpleVector {
+    static_assert(std::is_trivially_copyable_v<Type>, "MappedSimpleVector requires a trivially copyable type");
+
+public:
+    using Iterator = Type*;
+    using ConstIterator = const Type*;
+
+    //        (madvise)
+    enum class Advice {
+        NORMAL,
+        SEQUENTIAL,
+        RANDOM,
+        WILL_NEED,
+        DONT_NEED
+    };
+
+    MappedSimpleVector() noexcept = default;
+
+    //  ,    
+    explicit MappedSimpleVector(const std::string& path) {
+        Open(path);
+    }
+
+    MappedSimpleVector(const MappedSimpleVector&) = delete;
+    MappedSimpleVector& operator=(const MappedSimpleVector&) = delete;
+
+    MappedSimpleVector(MappedSimpleVector&& other) noexcept :
+        fd_{ std::exchange(other.fd_, -1) },
+        mapping_{ std::exchange(other.mapping_, nullptr) },
+        mapping_size_{ std::exchange(other.mapping_size_, 0) } {
+    }
+
+    MappedSimpleVector& operator=(MappedSimpleVector&& rhs) noexcept {
+        if (this != &rhs) {
+            Close();
+            fd_ = std::exchange(rhs.fd_, -1);
+            mapping_ = std::exchange(rhs.mapping_, nullptr);
+            mapping_size_ = std::exchange(rhs.mapping_size_, 0);
+        }
+        return *this;
+    }
+
+    ~MappedSimpleVector() {
+        Close();
+    }
+
+    void Open(const std::string& path) {
+        Close();
+        fd_ = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+        if (fd_ < 0) {
+            ThrowSystemError("open");
+        }
+        try {
+            struct stat info;
+            if (::fstat(fd_, &info) != 0) {
+                ThrowSystemError("fstat");
+            }
+            if (info.st_size == 0) {
+                Truncate(kHeaderSize);
+                Map(kHeaderSize);
+                GetHeader() = Header{ kMagic, sizeof(Type), 0 };
+            }
+            else {
+                if (static_cast<size_t>(info.st_size) < kHeaderSize) {
+                    throw std::runtime_error("Mapped file is too small");
+                }
+                Map(static_cast<size_t>(info.st_size));
+                const Header& header = GetHeader();
+                if (header.magic != kMagic || header.item_size != sizeof(Type)
+                    || header.size > GetCapacity()) {
+                    throw std::runtime_error("Mapped file has incompatible layout");
+                }
+            }
+        }
+        catch (...) {
+            Close();
+            throw;
+        }
+    }
+
+    //     .    
+    void Close() noexcept {
+        if (mapping_) {
+            ::munmap(mapping_, mapping_size_);
+            mapping_ = nullptr;
+            mapping_size_ = 0;
+        }
+        if (fd_ >= 0) {
+            ::close(fd_);
+            fd_ = -1;
+        }
+    }
+
+    bool IsOpen() const noexcept {
+        return mapping_ != nullptr;
+    }
+
+    size_t GetSize() const noexcept {
+        return mapping_ ? GetHeader().size : 0;
+    }
+
+    size_t GetCapacity() const noexcept {
+        return mapping_ ? (mapping_size_ - kHeaderSize) / sizeof(Type) : 0;
+    }
+
+    bool IsEmpty() const noexcept {
+        return GetSize() == 0;
+    }
+
+    Type& operator[](size_t index) noexcept {
+        assert(index < GetSize());
+        return Data()[index];
+    }
+
+    const Type& operator[](size_t index) const noexcept {
+        assert(index < GetSize());
+        return Data()[index];
+    }
+
+    Type& At(size_t index) {
+        if (index >= GetSize()) {
+            throw std::out_of_range("Index is Out of Range");
+        }
+        return Data()[index];
+    }
+
+    const Type& At(size_t index) const {
+        if (index >= GetSize()) {
+            throw std::out_of_range("Index is Out of Range");
+        }
+        return Data()[index];
+    }
+
+    void Clear() noexcept {
+        if (mapping_) {
+            GetHeader().size = 0;
+        }
+    }
+
+    //      
+    void Resize(size_t new_size) {
+        assert(IsOpen());
+        const size_t size = GetSize();
+        if (new_size > size) {
+            Reserve(new_size);
+            std::fill(Data() + size, Data() + new_size, Type{});
+        }
+        GetHeader().size = new_size;
+    }
+
+    //      new_capacity 
+    void Reserve(size_t new_capacity) {
+        assert(IsOpen());
+        if (new_capacity <= GetCapacity()) {
+            return;
+        }
+        const size_t new_mapping_size = kHeaderSize + new_capacity * sizeof(Type);
+        Truncate(new_mapping_size);
+        Remap(new_mapping_size);
+    }
+
+    //    GetSize() 
+    void ShrinkToFit() {
+        assert(IsOpen());
+        const size_t new_mapping_size = kHeaderSize + GetSize() * sizeof(Type);
+        if (new_mapping_size == mapping_size_) {
+            return;
+        }
+        Remap(new_mapping_size);
+        Truncate(new_mapping_size);
+    }
+
+    Iterator begin() noexcept {
+        return Data();
+    }
+
+    Iterator end() noexcept {
+        return Data() + GetSize();
+    }
+
+    ConstIterator begin() const noexcept {
+        return Data();
+    }
+
+    ConstIterator end() const noexcept {
+        return Data() + GetSize();
+    }
+
+    ConstIterator cbegin() const noexcept {
+        return begin();
+    }
+
+    ConstIterator cend() const noexcept {
+        return end();
+    }
+
+    void PushBack(const Type& item) {
+        assert(IsOpen());
+        const size_t size = GetSize();
+        if (size == GetCapacity()) {
+            // item    ,    
+            const Type copy = item;
+            Reserve(GrowthPolicy::NextCapacity(GetCapacity(), size + 1, sizeof(Type)));
+            Data()[size] = copy;
+        }
+        else {
+            Data()[size] = item;
+        }
+        GetHeader().size = size + 1;
+    }
+
+    void PopBack() noexcept {
+        assert(!IsEmpty());
+        --GetHeader().size;
+    }
+
+    //     .  async = true     
+    void Sync(bool async = false) {
+        assert(IsOpen());
+        if (::msync(mapping_, mapping_size_, async ? MS_ASYNC : MS_SYNC) != 0) {
+            ThrowSystemError("msync");
+        }
+    }
+
+    void Advise(Advice advice) {
+        assert(IsOpen());
+        if (::madvise(mapping_, mapping_size_, ToMadvise(advice)) != 0) {
+            ThrowSystemError("madvise");
+        }
+    }
+
+private:
+    //  .  kHeaderSize ,    
+    struct Header {
+        uint64_t magic;
+        uint64_t item_size;
+        uint64_t size;
+    };
+
+    static constexpr uint64_t kMagic = 0x31564D4953ull;  // "SIMV1"
+    static constexpr size_t kHeaderSize = 64;
+
+    static_assert(alignof(Type) <= kHeaderSize, "Type alignment exceeds mapped header size");
+
+    int fd_ = -1;
+    void* mapping_ = nullptr;
+    size_t mapping_size_ = 0;
+
+    [[noreturn]] static void ThrowSystemError(const char* what) {
+        throw std::system_error(errno, std::generic_category(), what);
+    }
+
+    static int ToMadvise(Advice advice) noexcept {
+        switch (advice) {
+        case Advice::SEQUENTIAL:
+            return MADV_SEQUENTIAL;
+        case Advice::RANDOM:
+            return MADV_RANDOM;
+        case Advice::WILL_NEED:
+            return MADV_WILLNEED;
+        case Advice::DONT_NEED:
+            return MADV_DONTNEED;
+        default:
+            return MADV_NORMAL;
+        }
+    }
+
+    Header& GetHeader() noexcept {
+        assert(mapping_);
+        return *static_cast<Header*>(mapping_);
+    }
+
+    const Header& GetHeader() const noexcept {
+        assert(mapping_);
+        return *static_cast<const Header*>(mapping_);
+    }
+
+    Type* Data() const noexcept {
+        return mapping_ ? reinterpret_cast<Type*>(static_cast<char*>(mapping_) + kHeaderSize) : nullptr;
+    }
+
+    void Truncate(size_t file_size) {
+        if (::ftruncate(fd_, static_cast<off_t>(file_size)) != 0) {
+            ThrowSystemError("ftruncate");
+        }
+    }
+
+    void Map(size_t mapping_size) {
+        void* mapping = ::mmap(nullptr, mapping_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+        if (mapping == MAP_FAILED) {
+            ThrowSystemError("mmap");
+        }
+        mapping_ = mapping;
+        mapping_size_ = mapping_size;
+    }
+
+    //  Linux    mremap  munmap,     .
+    //    ,       
+    void Remap(size_t new_mapping_size) {
+#ifdef __linux__
+        void* mapping = ::mremap(mapping_, mapping_size_, new_mapping_size, MREMAP_MAYMOVE);
+        if (mapping == MAP_FAILED) {
+            ThrowSystemError("mremap");
+        }
+        mapping_ = mapping;
+        mapping_size_ = new_mapping_size;
+#else
+        void* mapping = ::mmap(nullptr, new_mapping_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+        if (mapping == MAP_FAILED) {
+            ThrowSystemError("mmap");
+        }
+        ::munmap(mapping_, mapping_size_);
+        mapping_ = mapping;
+        mapping_size_ = new_mapping_size;
+#endif
+    }
+};
+
+#endif
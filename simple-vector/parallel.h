@@ -0,0 +1,365 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "simple_vector.h"
+
+//      (work stealing):     ,  
+//         ,     
+//    
+class ThreadPool {
+public:
+    //          ,      
+    explicit ThreadPool(size_t thread_count = std::thread::hardware_concurrency()) {
+        thread_count = std::max<size_t>(1, thread_count);
+        for (size_t i = 0; i < thread_count; ++i) {
+            queues_.EmplaceBack(std::make_unique<WorkerQueue>());
+        }
+        for (size_t i = 0; i < thread_count; ++i) {
+            workers_.EmplaceBack([this, i] {
+                WorkerLoop(i);
+            });
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool() {
+        {
+            std::lock_guard lock(sleep_mutex_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for (std::thread& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    size_t GetThreadCount() const noexcept {
+        return workers_.GetSize();
+    }
+
+    //         ,  -    
+    void Submit(std::function<void()> task) {
+        const size_t index = current_pool_ == this
+            ? current_index_
+            : next_queue_.fetch_add(1, std::memory_order_relaxed) % queues_.GetSize();
+        {
+            std::lock_guard lock(queues_[index]->mutex);
+            queues_[index]->tasks.push_back(std::move(task));
+        }
+        queued_.fetch_add(1, std::memory_order_release);
+        {
+            std::lock_guard lock(sleep_mutex_);
+        }
+        wake_.notify_one();
+    }
+
+    //       .  false,   
+    bool RunPendingTask() {
+        std::function<void()> task;
+        if (!TryPop(current_pool_ == this ? current_index_ : 0, task)) {
+            return false;
+        }
+        task();
+        return true;
+    }
+
+    //      
+    static ThreadPool& Default() {
+        static ThreadPool pool;
+        return pool;
+    }
+
+private:
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    SimpleVector<std::unique_ptr<WorkerQueue>> queues_;
+    SimpleVector<std::thread> workers_;
+
+    std::atomic<size_t> queued_{ 0 };
+    std::atomic<size_t> next_queue_{ 0 };
+
+    std::mutex sleep_mutex_;
+    std::condition_variable wake_;
+    bool stop_ = false;
+
+    static inline thread_local ThreadPool* current_pool_ = nullptr;
+    static inline thread_local size_t current_index_ = 0;
+
+    //      (    ),  -  
+    bool TryPop(size_t own_index, std::function<void()>& task) {
+        if (queued_.load(std::memory_order_acquire) == 0) {
+            return false;
+        }
+        const size_t count = queues_.GetSize();
+        for (size_t offset = 0; offset < count; ++offset) {
+            WorkerQueue& queue = *queues_[(own_index + offset) % count];
+            std::lock_guard lock(queue.mutex);
+            if (!queue.tasks.empty()) {
+                if (offset == 0) {
+                    task = std::move(queue.tasks.back());
+                    queue.tasks.pop_back();
+                }
+                else {
+                    task = std::move(queue.tasks.front());
+                    queue.tasks.pop_front();
+                }
+                queued_.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void WorkerLoop(size_t index) {
+        current_pool_ = this;
+        current_index_ = index;
+        std::function<void()> task;
+        while (true) {
+            if (TryPop(index, task)) {
+                task();
+                task = nullptr;
+                continue;
+            }
+            std::unique_lock lock(sleep_mutex_);
+            wake_.wait(lock, [this] {
+                return stop_ || queued_.load(std::memory_order_acquire) > 0;
+            });
+            if (stop_ && queued_.load(std::memory_order_acquire) == 0) {
+                return;
+            }
+        }
+    }
+};
+
+//   . Wait()   ,    ,  
+//        .       Wait()
+class TaskGroup {
+public:
+    explicit TaskGroup(ThreadPool& pool) noexcept
+        : pool_(pool) {
+    }
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    ~TaskGroup() {
+        WaitAll();
+    }
+
+    //     ,      ;  Submit
+    //  ,       
+    template <typename Func>
+    void Run(Func func) {
+        pending_.fetch_add(1, std::memory_order_relaxed);
+        try {
+            Submit(std::move(func));
+        }
+        catch (...) {
+            pending_.fetch_sub(1, std::memory_order_acq_rel);
+            throw;
+        }
+    }
+
+    void Wait() {
+        WaitAll();
+        if (error_) {
+            std::rethrow_exception(std::exchange(error_, nullptr));
+        }
+    }
+
+private:
+    ThreadPool& pool_;
+    std::atomic<size_t> pending_{ 0 };
+    std::mutex error_mutex_;
+    std::exception_ptr error_;
+
+    template <typename Func>
+    void Submit(Func func) {
+        pool_.Submit([this, func = std::move(func)]() mutable {
+            try {
+                func();
+            }
+            catch (...) {
+                std::lock_guard lock(error_mutex_);
+                if (!error_) {
+                    error_ = std::current_exception();
+                }
+            }
+            pending_.fetch_sub(1, std::memory_order_acq_rel);
+        });
+    }
+
+    void WaitAll() noexcept {
+        while (pending_.load(std::memory_order_acquire) > 0) {
+            if (!pool_.RunPendingTask()) {
+                std::this_thread::yield();
+            }
+        }
+    }
+};
+
+namespace parallel_detail {
+
+    //       
+    inline constexpr size_t kMinParallelItems = 4096;
+
+    //     -   L2-,    4   
+    inline constexpr size_t kChunkBytes = 256 * 1024;
+
+    inline size_t ChunkSize(size_t count, size_t item_size, size_t thread_count) noexcept {
+        const size_t by_cache = std::max<size_t>(1, kChunkBytes / std::max<size_t>(1, item_size));
+        const size_t by_balance = std::max<size_t>(1, count / (thread_count * 4));
+        return std::min(by_cache, by_balance);
+    }
+
+    //  body(chunk_first, chunk_last)   [first, last) 
+    template <typename RandomIt, typename Body>
+    void ForEachChunk(RandomIt first, RandomIt last, size_t chunk, ThreadPool& pool, Body body) {
+        TaskGroup group(pool);
+        while (last - first > static_cast<std::ptrdiff_t>(chunk)) {
+            RandomIt chunk_last = first + chunk;
+            group.Run([first, chunk_last, &body] {
+                body(first, chunk_last);
+            });
+            first = chunk_last;
+        }
+        body(first, last);
+        group.Wait();
+    }
+
+} // namespace parallel_detail
+
+//  func    [first, last)
+template <typename RandomIt, typename Func>
+void ParallelForEach(RandomIt first, RandomIt last, Func func, ThreadPool& pool = ThreadPool::Default()) {
+    const size_t count = last - first;
+    if (count < parallel_detail::kMinParallelItems || pool.GetThreadCount() < 2) {
+        std::for_each(first, last, func);
+        return;
+    }
+    const size_t chunk = parallel_detail::ChunkSize(count, sizeof(*first), pool.GetThreadCount());
+    parallel_detail::ForEachChunk(first, last, chunk, pool, [&func](RandomIt chunk_first, RandomIt chunk_last) {
+        std::for_each(chunk_first, chunk_last, func);
+    });
+}
+
+//  op(*it)    [first, last)  ,   out
+template <typename RandomIt, typename OutIt, typename UnaryOp>
+OutIt ParallelTransform(RandomIt first, RandomIt last, OutIt out, UnaryOp op, ThreadPool& pool = ThreadPool::Default()) {
+    const size_t count = last - first;
+    if (count < parallel_detail::kMinParallelItems || pool.GetThreadCount() < 2) {
+        return std::transform(first, last, out, op);
+    }
+    const size_t chunk = parallel_detail::ChunkSize(count, sizeof(*first), pool.GetThreadCount());
+    parallel_detail::ForEachChunk(first, last, chunk, pool, [first, out, &op](RandomIt chunk_first, RandomIt chunk_last) {
+        std::transform(chunk_first, chunk_last, out + (chunk_first - first), op);
+    });
+    return out + count;
+}
+
+//  [first, last)   op -  std::reduce   :
+//   op .   ,     ,
+//  init,       init   op.  Value  
+// ,  op   (Value, ),  (Value, Value).     std::accumulate
+//    op    (ParallelTransform)   
+template <typename RandomIt, typename Value, typename BinaryOp>
+Value ParallelReduce(RandomIt first, RandomIt last, Value init, BinaryOp op, ThreadPool& pool = ThreadPool::Default()) {
+    static_assert(std::is_constructible_v<Value, decltype(*first)>,
+        "ParallelReduce requires Value to be constructible from the element type");
+    static_assert(std::is_invocable_r_v<Value, BinaryOp&, Value, Value>,
+        "ParallelReduce requires op(Value, Value) to combine partial results");
+    const size_t count = last - first;
+    if (count < parallel_detail::kMinParallelItems || pool.GetThreadCount() < 2) {
+        return std::accumulate(first, last, std::move(init), op);
+    }
+    const size_t chunk = parallel_detail::ChunkSize(count, sizeof(*first), pool.GetThreadCount());
+    const size_t chunk_count = (count + chunk - 1) / chunk;
+
+    SimpleVector<Value> partials(Reserve(chunk_count));
+    for (size_t i = 0; i < chunk_count; ++i) {
+        partials.EmplaceBack(first[i * chunk]);
+    }
+    parallel_detail::ForEachChunk(first, last, chunk, pool, [first, chunk, &partials, &op](RandomIt chunk_first, RandomIt chunk_last) {
+        Value& partial = partials[(chunk_first - first) / chunk];
+        for (++chunk_first; chunk_first != chunk_last; ++chunk_first) {
+            partial = op(std::move(partial), *chunk_first);
+        }
+    });
+    for (Value& partial : partials) {
+        init = op(std::move(init), std::move(partial));
+    }
+    return init;
+}
+
+// :   ,   ,     
+template <typename RandomIt, typename Compare = std::less<>>
+void ParallelSort(RandomIt first, RandomIt last, Compare comp = Compare(), ThreadPool& pool = ThreadPool::Default()) {
+    const size_t count = last - first;
+    if (count < parallel_detail::kMinParallelItems || pool.GetThreadCount() < 2) {
+        std::sort(first, last, comp);
+        return;
+    }
+    const size_t chunk = (count + pool.GetThreadCount() * 2 - 1) / (pool.GetThreadCount() * 2);
+    parallel_detail::ForEachChunk(first, last, chunk, pool, [&comp](RandomIt chunk_first, RandomIt chunk_last) {
+        std::sort(chunk_first, chunk_last, comp);
+    });
+
+    for (size_t run = chunk; run < count; run *= 2) {
+        TaskGroup group(pool);
+        for (size_t begin = 0; begin + run < count; begin += 2 * run) {
+            RandomIt run_first = first + begin;
+            RandomIt run_middle = run_first + run;
+            RandomIt run_last = first + std::min(begin + 2 * run, count);
+            group.Run([run_first, run_middle, run_last, &comp] {
+                std::inplace_merge(run_first, run_middle, run_last, comp);
+            });
+        }
+        group.Wait();
+    }
+}
+
+//   SimpleVector
+
+template <typename Type, typename Allocator, typename GrowthPolicy, typename CheckPolicy, typename Func>
+void ParallelForEach(SimpleVector<Type, Allocator, GrowthPolicy, CheckPolicy>& vec, Func func, ThreadPool& pool = ThreadPool::Default()) {
+    ParallelForEach(vec.Data(), vec.Data() + vec.GetSize(), std::move(func), pool);
+}
+
+//  output  op    input
+template <typename Type, typename Allocator, typename GrowthPolicy, typename CheckPolicy, typename Result, typename ResultAllocator,
+          typename ResultGrowthPolicy, typename ResultCheckPolicy, typename UnaryOp>
+void ParallelTransform(const SimpleVector<Type, Allocator, GrowthPolicy, CheckPolicy>& input,
+                       SimpleVector<Result, ResultAllocator, ResultGrowthPolicy, ResultCheckPolicy>& output, UnaryOp op,
+                       ThreadPool& pool = ThreadPool::Default()) {
+    output.Resize(input.GetSize());
+    ParallelTransform(input.Data(), input.Data() + input.GetSize(), output.Data(), std::move(op), pool);
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy, typename CheckPolicy, typename Value, typename BinaryOp>
+Value ParallelReduce(const SimpleVector<Type, Allocator, GrowthPolicy, CheckPolicy>& vec, Value init, BinaryOp op,
+                     ThreadPool& pool = ThreadPool::Default()) {
+    return ParallelReduce(vec.Data(), vec.Data() + vec.GetSize(), std::move(init), std::move(op), pool);
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy, typename CheckPolicy, typename Compare = std::less<>>
+void ParallelSort(SimpleVector<Type, Allocator, GrowthPolicy, CheckPolicy>& vec, Compare comp = Compare(), ThreadPool& pool = ThreadPool::Default()) {
+    ParallelSort(vec.Data(), vec.Data() + vec.GetSize(), std::move(comp), pool);
+}
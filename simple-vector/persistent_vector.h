@@ -0,0 +1,696 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#include "simple_vector.h"
+
+//     :     32  
+//  .      ,   
+//       (  log32(n) ),   
+//   .         -   O(1)
+namespace persistent_detail {
+
+    inline constexpr size_t kBits = 5;
+    inline constexpr size_t kWidth = size_t{ 1 } << kBits;
+    inline constexpr size_t kMask = kWidth - 1;
+
+    //  : ,     ,   ,  
+    //    .   ,     
+    inline uint64_t NewEdit() noexcept {
+        static std::atomic<uint64_t> next{ 1 };
+        return next.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    struct Node {
+        Node(uint64_t edit_id, bool leaf) noexcept
+            : edit(edit_id), is_leaf(leaf) {
+        }
+
+        std::atomic<size_t> refs{ 1 };
+        uint64_t edit;
+        bool is_leaf;
+    };
+
+    struct Branch : Node {
+        explicit Branch(uint64_t edit_id) noexcept
+            : Node(edit_id, false) {
+        }
+
+        Node* children[kWidth] = {};
+    };
+
+    //    kWidth    ,  -  count
+    template <typename Type>
+    struct Leaf : Node {
+        explicit Leaf(uint64_t edit_id) noexcept
+            : Node(edit_id, true) {
+        }
+
+        ~Leaf() {
+            std::destroy_n(Items(), count);
+        }
+
+        Type* Items() noexcept {
+            return std::launder(reinterpret_cast<Type*>(storage));
+        }
+
+        const Type* Items() const noexcept {
+            return std::launder(reinterpret_cast<const Type*>(storage));
+        }
+
+        size_t count = 0;
+        alignas(Type) unsigned char storage[kWidth * sizeof(Type)];
+    };
+
+    //   .       edit:   
+    //  (  ),  -   .  [TailOffset(), size_) 
+    //  ,  -      shift_ / kBits
+    template <typename Type>
+    class Trie {
+        using LeafNode = Leaf<Type>;
+
+    public:
+        Trie() noexcept = default;
+
+        Trie(const Trie& other) noexcept
+            : size_(other.size_), shift_(other.shift_), root_(Retain(other.root_)), tail_(Retain(other.tail_)) {
+        }
+
+        Trie(Trie&& other) noexcept
+            : size_(std::exchange(other.size_, 0)), shift_(std::exchange(other.shift_, kBits)),
+              root_(std::exchange(other.root_, nullptr)), tail_(std::exchange(other.tail_, nullptr)) {
+        }
+
+        ~Trie() {
+            Release(root_);
+            Release(tail_);
+        }
+
+        Trie& operator=(Trie other) noexcept {
+            swap(other);
+            return *this;
+        }
+
+        void swap(Trie& other) noexcept {
+            std::swap(size_, other.size_);
+            std::swap(shift_, other.shift_);
+            std::swap(root_, other.root_);
+            std::swap(tail_, other.tail_);
+        }
+
+        size_t GetSize() const noexcept {
+            return size_;
+        }
+
+        //  ,    index
+        const Type* LeafFor(size_t index) const noexcept {
+            assert(index < size_);
+            return static_cast<const LeafNode*>(LeafNodeFor(index))->Items();
+        }
+
+        template <typename... Args>
+        void PushBack(uint64_t edit, Args&&... args) {
+            const size_t tail_size = size_ - TailOffset();
+            if (tail_ && tail_size < kWidth) {
+                LeafNode* tail = EditableLeaf(tail_, edit);
+                ::new (static_cast<void*>(tail->Items() + tail_size)) Type(std::forward<Args>(args)...);
+                ++tail->count;
+                ++size_;
+                return;
+            }
+            //   (  ):     ,    
+            LeafNode* new_tail = new LeafNode(edit);
+            try {
+                ::new (static_cast<void*>(new_tail->Items())) Type(std::forward<Args>(args)...);
+                new_tail->count = 1;
+                if (tail_) {
+                    PushTail(edit);
+                }
+            }
+            catch (...) {
+                delete new_tail;
+                throw;
+            }
+            tail_ = new_tail;
+            ++size_;
+        }
+
+        template <typename Value>
+        void Set(uint64_t edit, size_t index, Value&& value) {
+            assert(index < size_);
+            const size_t tail_offset = TailOffset();
+            if (index >= tail_offset) {
+                EditableLeaf(tail_, edit)->Items()[index - tail_offset] = std::forward<Value>(value);
+                return;
+            }
+            Node** slot = &root_;
+            for (size_t level = shift_; level > 0; level -= kBits) {
+                slot = &EditableBranch(*slot, edit)->children[(index >> level) & kMask];
+            }
+            EditableLeaf(*slot, edit)->Items()[index & kMask] = std::forward<Value>(value);
+        }
+
+        void PopBack(uint64_t edit) {
+            assert(size_ > 0);
+            if (size_ - TailOffset() > 1) {
+                LeafNode* tail = EditableLeaf(tail_, edit);
+                --tail->count;
+                std::destroy_at(tail->Items() + tail->count);
+                --size_;
+                return;
+            }
+            if (size_ == 1) {
+                Release(tail_);
+                tail_ = nullptr;
+                size_ = 0;
+                return;
+            }
+            //    :     
+            Node* new_tail = Retain(LeafNodeFor(size_ - 2));
+            try {
+                PopTail(edit, shift_, root_);
+            }
+            catch (...) {
+                Release(new_tail);
+                throw;
+            }
+            if (root_ && shift_ > kBits && static_cast<Branch*>(root_)->children[1] == nullptr) {
+                Node* child = Retain(static_cast<Branch*>(root_)->children[0]);
+                Release(root_);
+                root_ = child;
+                shift_ -= kBits;
+            }
+            Release(tail_);
+            tail_ = new_tail;
+            --size_;
+        }
+
+    private:
+        size_t size_ = 0;
+        size_t shift_ = kBits;
+        Node* root_ = nullptr;
+        Node* tail_ = nullptr;
+
+        size_t TailOffset() const noexcept {
+            return size_ < kWidth ? 0 : ((size_ - 1) >> kBits) << kBits;
+        }
+
+        const Node* LeafNodeFor(size_t index) const noexcept {
+            if (index >= TailOffset()) {
+                return tail_;
+            }
+            const Node* node = root_;
+            for (size_t level = shift_; level > 0; level -= kBits) {
+                node = static_cast<const Branch*>(node)->children[(index >> level) & kMask];
+            }
+            return node;
+        }
+
+        Node* LeafNodeFor(size_t index) noexcept {
+            return const_cast<Node*>(std::as_const(*this).LeafNodeFor(index));
+        }
+
+        static Node* Retain(Node* node) noexcept {
+            if (node) {
+                node->refs.fetch_add(1, std::memory_order_relaxed);
+            }
+            return node;
+        }
+
+        static void Release(Node* node) noexcept {
+            if (!node || node->refs.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+                return;
+            }
+            if (node->is_leaf) {
+                delete static_cast<LeafNode*>(node);
+            }
+            else {
+                Branch* branch = static_cast<Branch*>(node);
+                for (Node* child : branch->children) {
+                    Release(child);
+                }
+                delete branch;
+            }
+        }
+
+        //   slot,   edit:  ,  slot   
+        static Branch* EditableBranch(Node*& slot, uint64_t edit) {
+            if (!slot) {
+                slot = new Branch(edit);
+            }
+            else if (slot->edit != edit) {
+                Branch* copy = new Branch(edit);
+                const Branch* source = static_cast<const Branch*>(slot);
+                for (size_t i = 0; i < kWidth; ++i) {
+                    copy->children[i] = Retain(source->children[i]);
+                }
+                Release(slot);
+                slot = copy;
+            }
+            return static_cast<Branch*>(slot);
+        }
+
+        static LeafNode* EditableLeaf(Node*& slot, uint64_t edit) {
+            if (slot->edit != edit) {
+                const LeafNode* source = static_cast<const LeafNode*>(slot);
+                LeafNode* copy = new LeafNode(edit);
+                try {
+                    std::uninitialized_copy_n(source->Items(), source->count, copy->Items());
+                }
+                catch (...) {
+                    delete copy;
+                    throw;
+                }
+                copy->count = source->count;
+                Release(slot);
+                slot = copy;
+            }
+            return static_cast<LeafNode*>(slot);
+        }
+
+        //     level,     node. node    
+        static Node* NewPath(uint64_t edit, size_t level, Node* node) {
+            Node* path = node;
+            try {
+                for (; level > 0; level -= kBits) {
+                    Branch* branch = new Branch(edit);
+                    branch->children[0] = path;
+                    path = branch;
+                }
+            }
+            catch (...) {
+                while (path != node) {
+                    Node* next = static_cast<Branch*>(path)->children[0];
+                    delete static_cast<Branch*>(path);
+                    path = next;
+                }
+                throw;
+            }
+            return path;
+        }
+
+        //     ,       
+        void PushTail(uint64_t edit) {
+            if ((size_ >> kBits) > (size_t{ 1 } << shift_)) {
+                Branch* new_root = new Branch(edit);
+                try {
+                    new_root->children[1] = NewPath(edit, shift_, tail_);
+                }
+                catch (...) {
+                    delete new_root;
+                    throw;
+                }
+                new_root->children[0] = root_;
+                root_ = new_root;
+                shift_ += kBits;
+            }
+            else {
+                PushTail(edit, shift_, root_);
+            }
+        }
+
+        void PushTail(uint64_t edit, size_t level, Node*& slot) {
+            Branch* parent = EditableBranch(slot, edit);
+            Node*& child = parent->children[((size_ - 1) >> level) & kMask];
+            if (level == kBits) {
+                child = tail_;
+            }
+            else if (child) {
+                PushTail(edit, level - kBits, child);
+            }
+            else {
+                child = NewPath(edit, level - kBits, tail_);
+            }
+        }
+
+        //     slot   .   ,
+        //    false
+        bool PopTail(uint64_t edit, size_t level, Node*& slot) {
+            Branch* node = EditableBranch(slot, edit);
+            const size_t index = ((size_ - 2) >> level) & kMask;
+            if (level > kBits) {
+                if (PopTail(edit, level - kBits, node->children[index])) {
+                    return true;
+                }
+            }
+            else {
+                Release(node->children[index]);
+                node->children[index] = nullptr;
+            }
+            if (index == 0) {
+                Release(slot);
+                slot = nullptr;
+                return false;
+            }
+            return true;
+        }
+    };
+
+} // namespace persistent_detail
+
+template <typename Type>
+class TransientVector;
+
+template <typename Type>
+class PersistentVector {
+    using Trie = persistent_detail::Trie<Type>;
+
+public:
+    class ConstIterator;
+    using Iterator = ConstIterator;
+
+    PersistentVector() noexcept = default;
+
+    PersistentVector(std::initializer_list<Type> init) :
+        PersistentVector(init.begin(), init.end()) {
+    }
+
+    template <typename InputIt, typename = RequireInputIterator<InputIt>>
+    PersistentVector(InputIt first, InputIt last) {
+        TransientVector<Type> transient;
+        for (; first != last; ++first) {
+            transient.PushBack(*first);
+        }
+        *this = transient.Persistent();
+    }
+
+    size_t GetSize() const noexcept {
+        return trie_.GetSize();
+    }
+
+    bool IsEmpty() const noexcept {
+        return !GetSize();
+    }
+
+    const Type& operator[](size_t index) const noexcept {
+        assert(index < GetSize());
+        return trie_.LeafFor(index)[index & persistent_detail::kMask];
+    }
+
+    const Type& At(size_t index) const {
+        if (index >= GetSize()) {
+            throw std::out_of_range("Index is Out of Range");
+        }
+        return (*this)[index];
+    }
+
+    //    value  
+    [[nodiscard]] PersistentVector PushBack(const Type& value) const {
+        return Edited([&value](Trie& trie, uint64_t edit) { trie.PushBack(edit, value); });
+    }
+
+    [[nodiscard]] PersistentVector PushBack(Type&& value) const {
+        return Edited([&value](Trie& trie, uint64_t edit) { trie.PushBack(edit, std::move(value)); });
+    }
+
+    //  ,    index   value
+    [[nodiscard]] PersistentVector Set(size_t index, const Type& value) const {
+        assert(index < GetSize());
+        return Edited([index, &value](Trie& trie, uint64_t edit) { trie.Set(edit, index, value); });
+    }
+
+    //     
+    [[nodiscard]] PersistentVector PopBack() const {
+        assert(!IsEmpty());
+        return Edited([](Trie& trie, uint64_t edit) { trie.PopBack(edit); });
+    }
+
+    //    :     ,   ,  
+    //     .      
+    TransientVector<Type> Transient() const {
+        return TransientVector<Type>(trie_);
+    }
+
+    ConstIterator begin() const noexcept {
+        return ConstIterator(&trie_, 0);
+    }
+
+    ConstIterator end() const noexcept {
+        return ConstIterator(&trie_, GetSize());
+    }
+
+    ConstIterator cbegin() const noexcept {
+        return begin();
+    }
+
+    ConstIterator cend() const noexcept {
+        return end();
+    }
+
+    void swap(PersistentVector& other) noexcept {
+        trie_.swap(other.trie_);
+    }
+
+    //   :       
+    class ConstIterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Type*;
+        using reference = const Type&;
+
+        ConstIterator() = default;
+
+        reference operator*() const noexcept {
+            return leaf_[index_ & persistent_detail::kMask];
+        }
+
+        pointer operator->() const noexcept {
+            return &**this;
+        }
+
+        reference operator[](difference_type offset) const noexcept {
+            return *(*this + offset);
+        }
+
+        ConstIterator& operator++() noexcept {
+            ++index_;
+            if ((index_ & persistent_detail::kMask) == 0) {
+                Load();
+            }
+            return *this;
+        }
+
+        ConstIterator operator++(int) noexcept {
+            ConstIterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        ConstIterator& operator--() noexcept {
+            --index_;
+            //  end()   ,         
+            if (!leaf_ || (index_ & persistent_detail::kMask) == persistent_detail::kMask) {
+                Load();
+            }
+            return *this;
+        }
+
+        ConstIterator operator--(int) noexcept {
+            ConstIterator old = *this;
+            --*this;
+            return old;
+        }
+
+        ConstIterator& operator+=(difference_type offset) noexcept {
+            index_ += offset;
+            Load();
+            return *this;
+        }
+
+        ConstIterator& operator-=(difference_type offset) noexcept {
+            return *this += -offset;
+        }
+
+        friend ConstIterator operator+(ConstIterator it, difference_type offset) noexcept {
+            return it += offset;
+        }
+
+        friend ConstIterator operator+(difference_type offset, ConstIterator it) noexcept {
+            return it += offset;
+        }
+
+        friend ConstIterator operator-(ConstIterator it, difference_type offset) noexcept {
+            return it -= offset;
+        }
+
+        friend difference_type operator-(const ConstIterator& lhs, const ConstIterator& rhs) noexcept {
+            return static_cast<difference_type>(lhs.index_) - static_cast<difference_type>(rhs.index_);
+        }
+
+        friend bool operator==(const ConstIterator& lhs, const ConstIterator& rhs) noexcept {
+            return lhs.index_ == rhs.index_;
+        }
+
+        friend bool operator!=(const ConstIterator& lhs, const ConstIterator& rhs) noexcept {
+            return lhs.index_ != rhs.index_;
+        }
+
+        friend bool operator<(const ConstIterator& lhs, const ConstIterator& rhs) noexcept {
+            return lhs.index_ < rhs.index_;
+        }
+
+        friend bool operator>(const ConstIterator& lhs, const ConstIterator& rhs) noexcept {
+            return rhs < lhs;
+        }
+
+        friend bool operator<=(const ConstIterator& lhs, const ConstIterator& rhs) noexcept {
+            return !(rhs < lhs);
+        }
+
+        friend bool operator>=(const ConstIterator& lhs, const ConstIterator& rhs) noexcept {
+            return !(lhs < rhs);
+        }
+
+    private:
+        friend class PersistentVector;
+
+        ConstIterator(const Trie* trie, size_t index) noexcept
+            : trie_(trie), index_(index) {
+            Load();
+        }
+
+        void Load() noexcept {
+            leaf_ = index_ < trie_->GetSize() ? trie_->LeafFor(index_) : nullptr;
+        }
+
+        const Trie* trie_ = nullptr;
+        size_t index_ = 0;
+        const Type* leaf_ = nullptr;
+    };
+
+private:
+    friend class TransientVector<Type>;
+
+    Trie trie_;
+
+    explicit PersistentVector(Trie trie) noexcept
+        : trie_(std::move(trie)) {
+    }
+
+    //  ,    :    
+    template <typename Edit>
+    PersistentVector Edited(Edit edit) const {
+        Trie trie(trie_);
+        edit(trie, persistent_detail::NewEdit());
+        return PersistentVector(std::move(trie));
+    }
+};
+
+//   PersistentVector     . ,  ,
+//   ,  PushBack      SimpleVector   
+//   32 . Persistent()  :   ,  
+//      .       
+template <typename Type>
+class TransientVector {
+    using Trie = persistent_detail::Trie<Type>;
+
+public:
+    TransientVector() noexcept = default;
+
+    //         ,    
+    TransientVector(const TransientVector&) = delete;
+    TransientVector& operator=(const TransientVector&) = delete;
+
+    TransientVector(TransientVector&& other) noexcept
+        : trie_(std::move(other.trie_)), edit_(std::exchange(other.edit_, persistent_detail::NewEdit())) {
+    }
+
+    TransientVector& operator=(TransientVector&& other) noexcept {
+        if (this != &other) {
+            trie_ = std::move(other.trie_);
+            edit_ = std::exchange(other.edit_, persistent_detail::NewEdit());
+        }
+        return *this;
+    }
+
+    size_t GetSize() const noexcept {
+        return trie_.GetSize();
+    }
+
+    bool IsEmpty() const noexcept {
+        return !GetSize();
+    }
+
+    const Type& operator[](size_t index) const noexcept {
+        assert(index < GetSize());
+        return trie_.LeafFor(index)[index & persistent_detail::kMask];
+    }
+
+    const Type& At(size_t index) const {
+        if (index >= GetSize()) {
+            throw std::out_of_range("Index is Out of Range");
+        }
+        return (*this)[index];
+    }
+
+    void PushBack(const Type& value) {
+        trie_.PushBack(edit_, value);
+    }
+
+    void PushBack(Type&& value) {
+        trie_.PushBack(edit_, std::move(value));
+    }
+
+    template <typename... Args>
+    void EmplaceBack(Args&&... args) {
+        trie_.PushBack(edit_, std::forward<Args>(args)...);
+    }
+
+    void Set(size_t index, const Type& value) {
+        assert(index < GetSize());
+        trie_.Set(edit_, index, value);
+    }
+
+    void Set(size_t index, Type&& value) {
+        assert(index < GetSize());
+        trie_.Set(edit_, index, std::move(value));
+    }
+
+    void PopBack() {
+        assert(!IsEmpty());
+        trie_.PopBack(edit_);
+    }
+
+    //        
+    PersistentVector<Type> Persistent() noexcept {
+        edit_ = persistent_detail::NewEdit();
+        return PersistentVector<Type>(std::move(trie_));
+    }
+
+private:
+    friend class PersistentVector<Type>;
+
+    Trie trie_;
+    uint64_t edit_ = persistent_detail::NewEdit();
+
+    explicit TransientVector(const Trie& trie) noexcept
+        : trie_(trie) {
+    }
+};
+
+template <typename Type>
+void swap(PersistentVector<Type>& lhs, PersistentVector<Type>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+template <typename Type>
+bool operator==(const PersistentVector<Type>& lhs, const PersistentVector<Type>& rhs) {
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename Type>
+bool operator!=(const PersistentVector<Type>& lhs, const PersistentVector<Type>& rhs) {
+    return !(lhs == rhs);
+}
@@ -0,0 +1,412 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "array_ptr.h"
+#include "simple_vector.h"
+
+//     .        
+//   ,    ,    
+//       .      
+template <typename Type, size_t ChunkSize = 1024, typename Allocator = std::allocator<Type>>
+class SegmentedVector {
+    static_assert(ChunkSize > 0 && (ChunkSize & (ChunkSize - 1)) == 0, "ChunkSize must be a power of two");
+
+    using AllocTraits = std::allocator_traits<Allocator>;
+    using Chunk = ArrayPtr<Type, Allocator>;
+
+    template <bool IsConst>
+    class BasicIterator;
+
+public:
+    using Iterator = BasicIterator<false>;
+    using ConstIterator = BasicIterator<true>;
+
+    SegmentedVector() noexcept(noexcept(Allocator())) = default;
+
+    explicit SegmentedVector(const Allocator& alloc) noexcept :
+        alloc_(alloc) {
+    }
+
+    explicit SegmentedVector(size_t size, const Allocator& alloc = Allocator()) :
+        alloc_(alloc) {
+        Resize(size);
+    }
+
+    SegmentedVector(size_t size, const Type& value, const Allocator& alloc = Allocator()) :
+        alloc_(alloc) {
+        Reserve(size);
+        for (size_t i = 0; i < size; ++i) {
+            EmplaceBack(value);
+        }
+    }
+
+    SegmentedVector(std::initializer_list<Type> init, const Allocator& alloc = Allocator()) :
+        SegmentedVector(init.begin(), init.end(), alloc) {
+    }
+
+    template <typename InputIt, typename = RequireInputIterator<InputIt>>
+    SegmentedVector(InputIt first, InputIt last, const Allocator& alloc = Allocator()) :
+        alloc_(alloc) {
+        if constexpr (IsForwardIteratorV<InputIt>) {
+            Reserve(std::distance(first, last));
+        }
+        for (; first != last; ++first) {
+            EmplaceBack(*first);
+        }
+    }
+
+    SegmentedVector(const SegmentedVector& other) :
+        SegmentedVector(other, AllocTraits::select_on_container_copy_construction(other.GetAllocator())) {
+    }
+
+    SegmentedVector(const SegmentedVector& other, const Allocator& alloc) :
+        SegmentedVector(other.begin(), other.end(), alloc) {
+    }
+
+    SegmentedVector(SegmentedVector&& other) noexcept :
+        chunks_(std::move(other.chunks_)), size_{ std::exchange(other.size_, 0) }, alloc_(other.alloc_) {
+    }
+
+    ~SegmentedVector() {
+        Clear();
+    }
+
+    SegmentedVector& operator=(const SegmentedVector& rhs) {
+        if (this != &rhs) {
+            SegmentedVector tmp(rhs, AllocTraits::propagate_on_container_copy_assignment::value
+                ? rhs.GetAllocator() : GetAllocator());
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    //    ,   ,     
+    SegmentedVector& operator=(SegmentedVector&& rhs) noexcept {
+        if (this != &rhs) {
+            SegmentedVector tmp(std::move(rhs));
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    Allocator GetAllocator() const noexcept {
+        return alloc_;
+    }
+
+    size_t GetSize() const noexcept {
+        return size_;
+    }
+
+    size_t GetCapacity() const noexcept {
+        return chunks_.GetSize() * ChunkSize;
+    }
+
+    bool IsEmpty() const noexcept {
+        return !size_;
+    }
+
+    Type& operator[](size_t index) noexcept {
+        assert(index < size_);
+        return *Slot(index);
+    }
+
+    const Type& operator[](size_t index) const noexcept {
+        assert(index < size_);
+        return *Slot(index);
+    }
+
+    Type& At(size_t index) {
+        if (index >= size_) {
+            throw std::out_of_range("Index is Out of Range");
+        }
+        return *Slot(index);
+    }
+
+    const Type& At(size_t index) const {
+        if (index >= size_) {
+            throw std::out_of_range("Index is Out of Range");
+        }
+        return *Slot(index);
+    }
+
+    //  ,   
+    void Clear() noexcept {
+        DestroyTail(0);
+    }
+
+    //    ,  -      
+    void Resize(size_t new_size) {
+        if (new_size <= size_) {
+            DestroyTail(new_size);
+            return;
+        }
+        Reserve(new_size);
+        const size_t old_size = size_;
+        try {
+            while (size_ < new_size) {
+                const size_t count = std::min(new_size - size_, ChunkSize - size_ % ChunkSize);
+                Chunk& chunk = chunks_[size_ / ChunkSize];
+                chunk.UninitializedFill(Slot(size_), count);
+                size_ += count;
+            }
+        }
+        catch (...) {
+            DestroyTail(old_size);
+            throw;
+        }
+    }
+
+    //    capacity 
+    void Reserve(size_t capacity) {
+        const size_t chunk_count = (capacity + ChunkSize - 1) / ChunkSize;
+        chunks_.Reserve(chunk_count);
+        while (chunks_.GetSize() < chunk_count) {
+            chunks_.PushBack(Chunk(ChunkSize, alloc_));
+        }
+    }
+
+    //  ,    
+    void ShrinkToFit() {
+        const size_t chunk_count = (size_ + ChunkSize - 1) / ChunkSize;
+        while (chunks_.GetSize() > chunk_count) {
+            chunks_.PopBack();
+        }
+        chunks_.ShrinkToFit();
+    }
+
+    Iterator begin() noexcept {
+        return Iterator(chunks_.begin(), 0);
+    }
+
+    Iterator end() noexcept {
+        return Iterator(chunks_.begin(), size_);
+    }
+
+    ConstIterator begin() const noexcept {
+        return ConstIterator(chunks_.begin(), 0);
+    }
+
+    ConstIterator end() const noexcept {
+        return ConstIterator(chunks_.begin(), size_);
+    }
+
+    ConstIterator cbegin() const noexcept {
+        return begin();
+    }
+
+    ConstIterator cend() const noexcept {
+        return end();
+    }
+
+    //  Push_Back
+    void PushBack(const Type& item) {
+        EmplaceBack(item);
+    }
+
+    //  Push_Back
+    void PushBack(Type&& item) {
+        EmplaceBack(std::move(item));
+    }
+
+    //     ,        
+    template <typename... Args>
+    Type& EmplaceBack(Args&&... args) {
+        if (size_ == GetCapacity()) {
+            chunks_.PushBack(Chunk(ChunkSize, alloc_));
+        }
+        Type* place = Slot(size_);
+        chunks_[size_ / ChunkSize].Construct(place, std::forward<Args>(args)...);
+        ++size_;
+        return *place;
+    }
+
+    void PopBack() noexcept {
+        assert(size_ > 0);
+        DestroyTail(size_ - 1);
+    }
+
+    void swap(SegmentedVector& other) noexcept {
+        chunks_.swap(other.chunks_);
+        std::swap(size_, other.size_);
+        if constexpr (AllocTraits::propagate_on_container_swap::value) {
+            using std::swap;
+            swap(alloc_, other.alloc_);
+        }
+    }
+
+private:
+    SimpleVector<Chunk> chunks_;
+    size_t size_ = 0;
+    Allocator alloc_;
+
+    Type* Slot(size_t index) const noexcept {
+        return chunks_[index / ChunkSize].Get() + index % ChunkSize;
+    }
+
+    //     [new_size, size_) 
+    void DestroyTail(size_t new_size) noexcept {
+        while (size_ > new_size) {
+            const size_t first = std::max(new_size, (size_ - 1) / ChunkSize * ChunkSize);
+            chunks_[first / ChunkSize].Destroy(Slot(first), Slot(size_ - 1) + 1);
+            size_ = first;
+        }
+    }
+
+    template <bool IsConst>
+    class BasicIterator {
+        using ChunkPtr = const Chunk*;
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const Type*, Type*>;
+        using reference = std::conditional_t<IsConst, const Type&, Type&>;
+
+        BasicIterator() = default;
+
+        //      
+        template <bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+        BasicIterator(const BasicIterator<OtherConst>& other) noexcept
+            : chunks_(other.chunks_), index_(other.index_) {
+        }
+
+        reference operator*() const noexcept {
+            return *operator->();
+        }
+
+        pointer operator->() const noexcept {
+            return chunks_[index_ / ChunkSize].Get() + index_ % ChunkSize;
+        }
+
+        reference operator[](difference_type offset) const noexcept {
+            return *(*this + offset);
+        }
+
+        BasicIterator& operator++() noexcept {
+            ++index_;
+            return *this;
+        }
+
+        BasicIterator operator++(int) noexcept {
+            BasicIterator old = *this;
+            ++index_;
+            return old;
+        }
+
+        BasicIterator& operator--() noexcept {
+            --index_;
+            return *this;
+        }
+
+        BasicIterator operator--(int) noexcept {
+            BasicIterator old = *this;
+            --index_;
+            return old;
+        }
+
+        BasicIterator& operator+=(difference_type offset) noexcept {
+            index_ += offset;
+            return *this;
+        }
+
+        BasicIterator& operator-=(difference_type offset) noexcept {
+            index_ -= offset;
+            return *this;
+        }
+
+        friend BasicIterator operator+(BasicIterator it, difference_type offset) noexcept {
+            return it += offset;
+        }
+
+        friend BasicIterator operator+(difference_type offset, BasicIterator it) noexcept {
+            return it += offset;
+        }
+
+        friend BasicIterator operator-(BasicIterator it, difference_type offset) noexcept {
+            return it -= offset;
+        }
+
+        friend difference_type operator-(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return static_cast<difference_type>(lhs.index_) - static_cast<difference_type>(rhs.index_);
+        }
+
+        friend bool operator==(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return lhs.index_ == rhs.index_;
+        }
+
+        friend bool operator!=(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return lhs.index_ != rhs.index_;
+        }
+
+        friend bool operator<(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return lhs.index_ < rhs.index_;
+        }
+
+        friend bool operator>(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return rhs < lhs;
+        }
+
+        friend bool operator<=(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return !(rhs < lhs);
+        }
+
+        friend bool operator>=(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return !(lhs < rhs);
+        }
+
+    private:
+        friend class SegmentedVector;
+        friend class BasicIterator<!IsConst>;
+
+        BasicIterator(ChunkPtr chunks, size_t index) noexcept
+            : chunks_(chunks), index_(index) {
+        }
+
+        ChunkPtr chunks_ = nullptr;
+        size_t index_ = 0;
+    };
+};
+
+template <typename Type, size_t ChunkSize, typename Allocator>
+void swap(SegmentedVector<Type, ChunkSize, Allocator>& lhs, SegmentedVector<Type, ChunkSize, Allocator>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+template <typename Type, size_t ChunkSize, typename Allocator>
+inline bool operator==(const SegmentedVector<Type, ChunkSize, Allocator>& lhs, const SegmentedVector<Type, ChunkSize, Allocator>& rhs) {
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename Type, size_t ChunkSize, typename Allocator>
+inline bool operator!=(const SegmentedVector<Type, ChunkSize, Allocator>& lhs, const SegmentedVector<Type, ChunkSize, Allocator>& rhs) {
+    return !(lhs == rhs);
+}
+
+template <typename Type, size_t ChunkSize, typename Allocator>
+inline bool operator<(const SegmentedVector<Type, ChunkSize, Allocator>& lhs, const SegmentedVector<Type, ChunkSize, Allocator>& rhs) {
+    return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename Type, size_t ChunkSize, typename Allocator>
+inline bool operator<=(const SegmentedVector<Type, ChunkSize, Allocator>& lhs, const SegmentedVector<Type, ChunkSize, Allocator>& rhs) {
+    return !(rhs < lhs);
+}
+
+template <typename Type, size_t ChunkSize, typename Allocator>
+inline bool operator>(const SegmentedVector<Type, ChunkSize, Allocator>& lhs, const SegmentedVector<Type, ChunkSize, Allocator>& rhs) {
+    return rhs < lhs;
+}
+
+template <typename Type, size_t ChunkSize, typename Allocator>
+inline bool operator>=(const SegmentedVector<Type, ChunkSize, Allocator>& lhs, const SegmentedVector<Type, ChunkSize, Allocator>& rhs) {
+    return !(lhs < rhs);
+}
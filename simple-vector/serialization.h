@@ -0,0 +1,485 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <cerrno>
+#include <system_error>
+#include <sys/stat.h>
+#include <unistd.h>
+#define SIMPLE_VECTOR_POSIX_IO
+#endif
+
+#include "simple_vector.h"
+
+//   SimpleVector:  SerializedHeader    .  
+//          ,  -  Serializer<Type>.
+//         :     
+
+//    :   64-   8 ,
+//     ,    
+class Checksum {
+public:
+    void Update(const void* data, size_t size) noexcept {
+        auto bytes = static_cast<const unsigned char*>(data);
+        total_ += size;
+        if (pending_size_ > 0 && size > 0) {
+            const size_t take = std::min(size, kBlockSize - pending_size_);
+            std::memcpy(pending_ + pending_size_, bytes, take);
+            pending_size_ += take;
+            bytes += take;
+            size -= take;
+            if (pending_size_ == kBlockSize) {
+                ProcessBlock(pending_);
+                pending_size_ = 0;
+            }
+        }
+        for (; size >= kBlockSize; bytes += kBlockSize, size -= kBlockSize) {
+            ProcessBlock(bytes);
+        }
+        if (size > 0) {
+            std::memcpy(pending_, bytes, size);
+            pending_size_ = size;
+        }
+    }
+
+    uint64_t Get() const noexcept {
+        uint64_t hash = total_ * kPrime2;
+        for (uint64_t lane : lanes_) {
+            hash = Rotl(hash ^ lane, 27) * kPrime1 + kPrime2;
+        }
+        for (size_t i = 0; i < pending_size_; ++i) {
+            hash = Rotl(hash ^ (pending_[i] * kPrime1), 11) * kPrime2;
+        }
+        hash ^= hash >> 33;
+        hash *= kPrime2;
+        hash ^= hash >> 29;
+        return hash;
+    }
+
+private:
+    static constexpr size_t kBlockSize = 32;
+    static constexpr uint64_t kPrime1 = 0x9E3779B185EBCA87ull;
+    static constexpr uint64_t kPrime2 = 0xC2B2AE3D27D4EB4Full;
+
+    uint64_t lanes_[4] = { kPrime1 + kPrime2, kPrime2, 0, 0 - kPrime1 };
+    unsigned char pending_[kBlockSize] = {};
+    size_t pending_size_ = 0;
+    uint64_t total_ = 0;
+
+    static uint64_t Rotl(uint64_t value, int shift) noexcept {
+        return (value << shift) | (value >> (64 - shift));
+    }
+
+    void ProcessBlock(const unsigned char* block) noexcept {
+        for (size_t lane = 0; lane < 4; ++lane) {
+            uint64_t word;
+            std::memcpy(&word, block + lane * 8, sizeof(word));
+            lanes_[lane] = Rotl(lanes_[lane] + word * kPrime2, 31) * kPrime1;
+        }
+    }
+};
+
+//    ,    .     
+//  ,    ChecksumOnly:         
+class BinaryWriter {
+public:
+    struct ChecksumOnly {
+    };
+
+    explicit BinaryWriter(ChecksumOnly) noexcept {
+    }
+
+    explicit BinaryWriter(std::ostream& out) noexcept :
+        out_(&out) {
+    }
+
+#ifdef SIMPLE_VECTOR_POSIX_IO
+    explicit BinaryWriter(int fd) :
+        fd_(fd) {
+        if (fd < 0) {
+            throw std::invalid_argument("Invalid file descriptor");
+        }
+    }
+#endif
+
+    void Write(const void* data, size_t size) {
+        if (out_) {
+            if (!out_->write(static_cast<const char*>(data), static_cast<std::streamsize>(size))) {
+                throw std::runtime_error("Failed to write vector data");
+            }
+        }
+#ifdef SIMPLE_VECTOR_POSIX_IO
+        else if (fd_ >= 0) {
+            auto bytes = static_cast<const char*>(data);
+            while (size > 0) {
+                const ssize_t written = ::write(fd_, bytes, std::min(size, kMaxIoSize));
+                if (written < 0) {
+                    if (errno == EINTR) {
+                        continue;
+                    }
+                    throw std::system_error(errno, std::generic_category(), "write");
+                }
+                bytes += written;
+                size -= static_cast<size_t>(written);
+            }
+        }
+#endif
+        else {
+            checksum_.Update(data, size);
+        }
+    }
+
+    template <typename Value>
+    void WriteValue(const Value& value) {
+        static_assert(std::is_trivially_copyable_v<Value>, "WriteValue requires a trivially copyable type");
+        Write(&value, sizeof(value));
+    }
+
+    uint64_t GetChecksum() const noexcept {
+        return checksum_.Get();
+    }
+
+private:
+    static constexpr size_t kMaxIoSize = size_t{ 1 } << 30;
+
+    std::ostream* out_ = nullptr;
+    int fd_ = -1;
+    Checksum checksum_;
+};
+
+//       
+class BinaryReader {
+public:
+    explicit BinaryReader(std::istream& in) noexcept :
+        in_(&in) {
+    }
+
+#ifdef SIMPLE_VECTOR_POSIX_IO
+    explicit BinaryReader(int fd) :
+        fd_(fd) {
+        if (fd < 0) {
+            throw std::invalid_argument("Invalid file descriptor");
+        }
+    }
+#endif
+
+    void Read(void* data, size_t size) {
+        if (in_) {
+            if (!in_->read(static_cast<char*>(data), static_cast<std::streamsize>(size))) {
+                throw std::runtime_error("Unexpected end of vector data");
+            }
+        }
+#ifdef SIMPLE_VECTOR_POSIX_IO
+        else {
+            auto bytes = static_cast<char*>(data);
+            for (size_t left = size; left > 0;) {
+                const ssize_t received = ::read(fd_, bytes, std::min(left, kMaxIoSize));
+                if (received < 0) {
+                    if (errno == EINTR) {
+                        continue;
+                    }
+                    throw std::system_error(errno, std::generic_category(), "read");
+                }
+                if (received == 0) {
+                    throw std::runtime_error("Unexpected end of vector data");
+                }
+                bytes += received;
+                left -= static_cast<size_t>(received);
+            }
+        }
+#endif
+        checksum_.Update(data, size);
+    }
+
+    template <typename Value>
+    Value ReadValue() {
+        static_assert(std::is_trivially_copyable_v<Value>, "ReadValue requires a trivially copyable type");
+        Value value;
+        Read(&value, sizeof(value));
+        return value;
+    }
+
+    uint64_t GetChecksum() const noexcept {
+        return checksum_.Get();
+    }
+
+    //     ,   
+    void ResetChecksum() noexcept {
+        checksum_ = Checksum();
+    }
+
+    //           ,  kUnknownSize
+    size_t GetRemainingBytes() {
+        if (in_) {
+            const std::streamoff pos = in_->tellg();
+            if (pos < 0 || !in_->seekg(0, std::ios::end)) {
+                in_->clear();
+                return kUnknownSize;
+            }
+            const std::streamoff end = in_->tellg();
+            in_->seekg(pos);
+            return end < pos ? 0 : static_cast<size_t>(end - pos);
+        }
+#ifdef SIMPLE_VECTOR_POSIX_IO
+        struct stat info;
+        if (::fstat(fd_, &info) == 0 && S_ISREG(info.st_mode)) {
+            const off_t pos = ::lseek(fd_, 0, SEEK_CUR);
+            if (pos >= 0) {
+                return info.st_size < pos ? 0 : static_cast<size_t>(info.st_size - pos);
+            }
+        }
+#endif
+        return kUnknownSize;
+    }
+
+    static constexpr size_t kUnknownSize = static_cast<size_t>(-1);
+
+private:
+    static constexpr size_t kMaxIoSize = size_t{ 1 } << 30;
+
+    std::istream* in_ = nullptr;
+    int fd_ = -1;
+    Checksum checksum_;
+};
+
+//      ,    .
+//      
+// static void Write(BinaryWriter&, const Type&)  static Type Read(BinaryReader&)
+template <typename Type, typename = void>
+struct Serializer;
+
+template <typename Type>
+struct Serializer<Type, std::enable_if_t<std::is_trivially_copyable_v<Type>>> {
+    static void Write(BinaryWriter& writer, const Type& item) {
+        writer.WriteValue(item);
+    }
+
+    static Type Read(BinaryReader& reader) {
+        return reader.ReadValue<Type>();
+    }
+};
+
+template <>
+struct Serializer<std::string> {
+    static void Write(BinaryWriter& writer, const std::string& item) {
+        writer.WriteValue(static_cast<uint64_t>(item.size()));
+        writer.Write(item.data(), item.size());
+    }
+
+    //    ,        
+    static std::string Read(BinaryReader& reader) {
+        constexpr size_t kStep = size_t{ 1 } << 20;
+        const size_t size = static_cast<size_t>(reader.ReadValue<uint64_t>());
+        std::string item;
+        for (size_t done = 0; done < size;) {
+            const size_t step = std::min(size - done, kStep);
+            item.resize(done + step);
+            reader.Read(item.data() + done, step);
+            done += step;
+        }
+        return item;
+    }
+};
+
+struct SerializedHeader {
+    uint32_t magic;
+    uint16_t version;
+    // kBulkPayload -     
+    uint16_t flags;
+    // kByteOrderMark     
+    uint32_t byte_order;
+    uint32_t item_size;
+    uint64_t count;
+    //     
+    uint64_t checksum;
+
+    static constexpr uint32_t kMagic = 0x43455653u;  // "SVEC"
+    static constexpr uint16_t kVersion = 1;
+    static constexpr uint16_t kBulkPayload = 1;
+    static constexpr uint32_t kByteOrderMark = 0x01020304u;
+};
+
+static_assert(sizeof(SerializedHeader) == 32, "SerializedHeader must have no padding");
+
+//    ,         .
+//       .     
+//  ,           
+template <typename Type>
+class SimpleVectorReader {
+public:
+    explicit SimpleVectorReader(std::istream& in) :
+        reader_(in) {
+        ReadHeader();
+    }
+
+#ifdef SIMPLE_VECTOR_POSIX_IO
+    explicit SimpleVectorReader(int fd) :
+        reader_(fd) {
+        ReadHeader();
+    }
+#endif
+
+    //      
+    size_t GetSize() const noexcept {
+        return static_cast<size_t>(header_.count);
+    }
+
+    size_t GetRemaining() const noexcept {
+        return remaining_;
+    }
+
+    bool IsDone() const noexcept {
+        return remaining_ == 0;
+    }
+
+    //      ,        
+    bool IsSizeVerified() const noexcept {
+        return size_verified_;
+    }
+
+    //   vec  max_items     
+    template <typename Allocator, typename GrowthPolicy, typename CheckPolicy>
+    size_t ReadChunk(SimpleVector<Type, Allocator, GrowthPolicy, CheckPolicy>& vec, size_t max_items) {
+        const size_t count = std::min(max_items, remaining_);
+        const size_t old_size = vec.GetSize();
+        if constexpr (kBulk) {
+            try {
+                for (size_t done = 0; done < count;) {
+                    const size_t step = std::min(count - done, kItemsPerStep);
+                    vec.ResizeUninitialized(old_size + done + step);
+                    reader_.Read(vec.Data() + old_size + done, step * sizeof(Type));
+                    done += step;
+                }
+            }
+            catch (...) {
+                vec.ResizeUninitialized(old_size);
+                throw;
+            }
+        }
+        else {
+            for (size_t i = 0; i < count; ++i) {
+                vec.PushBack(Serializer<Type>::Read(reader_));
+            }
+        }
+        remaining_ -= count;
+        if (remaining_ == 0 && reader_.GetChecksum() != header_.checksum) {
+            throw std::runtime_error("Vector data checksum mismatch");
+        }
+        return count;
+    }
+
+private:
+    static constexpr bool kBulk = std::is_trivially_copyable_v<Type>;
+    //    ,    , - 1 
+    static constexpr size_t kItemsPerStep = std::max<size_t>(1, (size_t{ 1 } << 20) / sizeof(Type));
+
+    BinaryReader reader_;
+    SerializedHeader header_{};
+    size_t remaining_ = 0;
+    bool size_verified_ = false;
+
+    void ReadHeader() {
+        header_ = reader_.ReadValue<SerializedHeader>();
+        if (header_.magic != SerializedHeader::kMagic) {
+            throw std::runtime_error("Not a serialized vector");
+        }
+        if (header_.version != SerializedHeader::kVersion) {
+            throw std::runtime_error("Unsupported serialized vector version");
+        }
+        if (header_.byte_order != SerializedHeader::kByteOrderMark) {
+            throw std::runtime_error("Serialized vector has foreign byte order");
+        }
+        if (header_.item_size != sizeof(Type) || ((header_.flags & SerializedHeader::kBulkPayload) != 0) != kBulk) {
+            throw std::runtime_error("Serialized vector has incompatible element type");
+        }
+        if constexpr (kBulk) {
+            const size_t available = reader_.GetRemainingBytes();
+            if (available != BinaryReader::kUnknownSize) {
+                if (header_.count > available / sizeof(Type)) {
+                    throw std::runtime_error("Serialized vector is truncated");
+                }
+                size_verified_ = true;
+            }
+        }
+        reader_.ResetChecksum();
+        remaining_ = static_cast<size_t>(header_.count);
+    }
+};
+
+namespace serialization_detail {
+
+    //          ,
+    //            .  
+    //  :      
+    template <typename Type, typename Allocator, typename GrowthPolicy, typename CheckPolicy>
+    void Save(const SimpleVector<Type, Allocator, GrowthPolicy, CheckPolicy>& vec, BinaryWriter& writer) {
+        constexpr bool bulk = std::is_trivially_copyable_v<Type>;
+        SerializedHeader header{ SerializedHeader::kMagic, SerializedHeader::kVersion,
+            bulk ? SerializedHeader::kBulkPayload : uint16_t{ 0 }, SerializedHeader::kByteOrderMark,
+            static_cast<uint32_t>(sizeof(Type)), vec.GetSize(), 0 };
+        if constexpr (bulk) {
+            Checksum checksum;
+            checksum.Update(vec.Data(), vec.GetSize() * sizeof(Type));
+            header.checksum = checksum.Get();
+            writer.WriteValue(header);
+            writer.Write(vec.Data(), vec.GetSize() * sizeof(Type));
+        }
+        else {
+            BinaryWriter counter(BinaryWriter::ChecksumOnly{});
+            for (const Type& item : vec) {
+                Serializer<Type>::Write(counter, item);
+            }
+            header.checksum = counter.GetChecksum();
+            writer.WriteValue(header);
+            for (const Type& item : vec) {
+                Serializer<Type>::Write(writer, item);
+            }
+        }
+    }
+
+    //          
+    template <typename Type, typename Allocator, typename GrowthPolicy, typename CheckPolicy>
+    void Load(SimpleVector<Type, Allocator, GrowthPolicy, CheckPolicy>& vec, SimpleVectorReader<Type>& reader) {
+        SimpleVector<Type, Allocator, GrowthPolicy, CheckPolicy> loaded(vec.GetAllocator());
+        if (reader.IsSizeVerified()) {
+            loaded.Reserve(reader.GetSize());
+        }
+        reader.ReadChunk(loaded, reader.GetSize());
+        vec.swap(loaded);
+    }
+
+} // namespace serialization_detail
+
+template <typename Type, typename Allocator, typename GrowthPolicy, typename CheckPolicy>
+void Save(const SimpleVector<Type, Allocator, GrowthPolicy, CheckPolicy>& vec, std::ostream& out) {
+    BinaryWriter writer(out);
+    serialization_detail::Save(vec, writer);
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy, typename CheckPolicy>
+void Load(SimpleVector<Type, Allocator, GrowthPolicy, CheckPolicy>& vec, std::istream& in) {
+    SimpleVectorReader<Type> reader(in);
+    serialization_detail::Load(vec, reader);
+}
+
+#ifdef SIMPLE_VECTOR_POSIX_IO
+template <typename Type, typename Allocator, typename GrowthPolicy, typename CheckPolicy>
+void Save(const SimpleVector<Type, Allocator, GrowthPolicy, CheckPolicy>& vec, int fd) {
+    BinaryWriter writer(fd);
+    serialization_detail::Save(vec, writer);
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy, typename CheckPolicy>
+void Load(SimpleVector<Type, Allocator, GrowthPolicy, CheckPolicy>& vec, int fd) {
+    SimpleVectorReader<Type> reader(fd);
+    serialization_detail::Load(vec, reader);
+}
+#endif
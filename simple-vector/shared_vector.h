@@ -0,0 +1,287 @@
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "simple_vector.h"
+
+// SimpleVector    .         
+//     ;       
+// ( operator[], At, begin/end, PushBack, Insert, Erase, Resize  ..)   .
+// ,        ,   : 
+//     ,     ,    .
+//         ,   -   SimpleVector
+template <typename Type, typename Allocator = std::allocator<Type>, typename GrowthPolicy = DoublingGrowth>
+class SharedSimpleVector {
+    using Vector = SimpleVector<Type, Allocator, GrowthPolicy>;
+
+    //     
+    struct Buffer {
+        template <typename... Args>
+        explicit Buffer(Args&&... args)
+            : items(std::forward<Args>(args)...) {
+        }
+
+        std::atomic<size_t> refs{ 1 };
+        //      ;      
+        bool unshareable = false;
+        Vector items;
+    };
+
+public:
+    using Iterator = typename Vector::Iterator;
+    using ConstIterator = typename Vector::ConstIterator;
+
+    SharedSimpleVector() noexcept = default;
+
+    explicit SharedSimpleVector(size_t size) :
+        buffer_(new Buffer(size)) {
+    }
+
+    SharedSimpleVector(size_t size, const Type& value) :
+        buffer_(new Buffer(size, value)) {
+    }
+
+    SharedSimpleVector(std::initializer_list<Type> init) :
+        buffer_(new Buffer(init)) {
+    }
+
+    template <typename InputIt, typename = RequireInputIterator<InputIt>>
+    SharedSimpleVector(InputIt first, InputIt last) :
+        buffer_(new Buffer(first, last)) {
+    }
+
+    //       
+    explicit SharedSimpleVector(Vector&& items) :
+        buffer_(new Buffer(std::move(items))) {
+    }
+
+    //   other,     
+    SharedSimpleVector(const SharedSimpleVector& other) :
+        buffer_(other.buffer_) {
+        if (buffer_ && buffer_->unshareable) {
+            buffer_ = new Buffer(other.buffer_->items);
+        }
+        else if (buffer_) {
+            buffer_->refs.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    SharedSimpleVector(SharedSimpleVector&& other) noexcept :
+        buffer_(std::exchange(other.buffer_, nullptr)) {
+    }
+
+    ~SharedSimpleVector() {
+        Release();
+    }
+
+    SharedSimpleVector& operator=(const SharedSimpleVector& rhs) {
+        SharedSimpleVector tmp(rhs);
+        swap(tmp);
+        return *this;
+    }
+
+    SharedSimpleVector& operator=(SharedSimpleVector&& rhs) noexcept {
+        SharedSimpleVector tmp(std::move(rhs));
+        swap(tmp);
+        return *this;
+    }
+
+    size_t GetSize() const noexcept {
+        return buffer_ ? buffer_->items.GetSize() : 0;
+    }
+
+    size_t GetCapacity() const noexcept {
+        return buffer_ ? buffer_->items.GetCapacity() : 0;
+    }
+
+    bool IsEmpty() const noexcept {
+        return GetSize() == 0;
+    }
+
+    //     ,     
+    bool IsShared() const noexcept {
+        return buffer_ && buffer_->refs.load(std::memory_order_acquire) > 1;
+    }
+
+    size_t GetUseCount() const noexcept {
+        return buffer_ ? buffer_->refs.load(std::memory_order_relaxed) : 0;
+    }
+
+    //    SimpleVector      (Find, Sum, ...)
+    const Vector& AsVector() const noexcept {
+        static const Vector empty;
+        return buffer_ ? buffer_->items : empty;
+    }
+
+    const Type& operator[](size_t index) const noexcept {
+        assert(index < GetSize());
+        return buffer_->items[index];
+    }
+
+    Type& operator[](size_t index) {
+        assert(index < GetSize());
+        return Leak()[index];
+    }
+
+    const Type& At(size_t index) const {
+        if (index >= GetSize()) {
+            throw std::out_of_range("Index is Out of Range");
+        }
+        return buffer_->items[index];
+    }
+
+    Type& At(size_t index) {
+        if (index >= GetSize()) {
+            throw std::out_of_range("Index is Out of Range");
+        }
+        return Leak()[index];
+    }
+
+    ConstIterator begin() const noexcept {
+        return AsVector().begin();
+    }
+
+    ConstIterator end() const noexcept {
+        return AsVector().end();
+    }
+
+    ConstIterator cbegin() const noexcept {
+        return begin();
+    }
+
+    ConstIterator cend() const noexcept {
+        return end();
+    }
+
+    //        :     
+    Iterator begin() {
+        return Leak().begin();
+    }
+
+    Iterator end() {
+        return Leak().end();
+    }
+
+    void PushBack(const Type& item) {
+        Mutable().PushBack(item);
+    }
+
+    void PushBack(Type&& item) {
+        Mutable().PushBack(std::move(item));
+    }
+
+    template <typename... Args>
+    Type& EmplaceBack(Args&&... args) {
+        return Leak().EmplaceBack(std::forward<Args>(args)...);
+    }
+
+    void PopBack() {
+        assert(!IsEmpty());
+        Mutable().PopBack();
+    }
+
+    //           
+    Iterator Insert(ConstIterator pos, const Type& value) {
+        const size_t index = pos - cbegin();
+        Vector& items = Leak();
+        return items.Insert(items.cbegin() + index, value);
+    }
+
+    Iterator Insert(ConstIterator pos, Type&& value) {
+        const size_t index = pos - cbegin();
+        Vector& items = Leak();
+        return items.Insert(items.cbegin() + index, std::move(value));
+    }
+
+    Iterator Erase(ConstIterator pos) {
+        const size_t index = pos - cbegin();
+        Vector& items = Leak();
+        return items.Erase(items.cbegin() + index);
+    }
+
+    Iterator Erase(ConstIterator first, ConstIterator last) {
+        const size_t first_index = first - cbegin();
+        const size_t last_index = last - cbegin();
+        Vector& items = Leak();
+        return items.Erase(items.cbegin() + first_index, items.cbegin() + last_index);
+    }
+
+    void Resize(size_t new_size) {
+        if (new_size != GetSize()) {
+            Mutable().Resize(new_size);
+        }
+    }
+
+    void Reserve(size_t new_capacity) {
+        if (new_capacity > GetCapacity()) {
+            Mutable().Reserve(new_capacity);
+        }
+    }
+
+    //    ,   .    
+    // ,     
+    void Clear() noexcept {
+        if (IsShared()) {
+            Release();
+        }
+        else if (buffer_) {
+            buffer_->items.Clear();
+            buffer_->unshareable = false;
+        }
+    }
+
+    void swap(SharedSimpleVector& other) noexcept {
+        std::swap(buffer_, other.buffer_);
+    }
+
+private:
+    Buffer* buffer_ = nullptr;
+
+    //    :   ,        .
+    // acquire       ,   
+    Vector& Mutable() {
+        if (!buffer_) {
+            buffer_ = new Buffer();
+        }
+        else if (buffer_->refs.load(std::memory_order_acquire) != 1) {
+            Buffer* copy = new Buffer(buffer_->items);
+            Release();
+            buffer_ = copy;
+        }
+        return buffer_->items;
+    }
+
+    //  ,         
+    Vector& Leak() {
+        Vector& items = Mutable();
+        buffer_->unshareable = true;
+        return items;
+    }
+
+    void Release() noexcept {
+        if (buffer_ && buffer_->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete buffer_;
+        }
+        buffer_ = nullptr;
+    }
+};
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+void swap(SharedSimpleVector<Type, Allocator, GrowthPolicy>& lhs, SharedSimpleVector<Type, Allocator, GrowthPolicy>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+bool operator==(const SharedSimpleVector<Type, Allocator, GrowthPolicy>& lhs, const SharedSimpleVector<Type, Allocator, GrowthPolicy>& rhs) {
+    return lhs.AsVector() == rhs.AsVector();
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy>
+bool operator!=(const SharedSimpleVector<Type, Allocator, GrowthPolicy>& lhs, const SharedSimpleVector<Type, Allocator, GrowthPolicy>& rhs) {
+    return !(lhs == rhs);
+}
@@ -0,0 +1,623 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+
+//         (SSE2/AVX2).
+//         ,  
+//    SIMPLE_VECTOR_NO_SIMD    std
+
+#if !defined(SIMPLE_VECTOR_NO_SIMD) && (defined(__x86_64__) || defined(_M_X64))
+#define SIMPLE_VECTOR_X86_SIMD 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(SIMPLE_VECTOR_X86_SIMD) && (defined(__GNUC__) || defined(__clang__))
+#define SIMPLE_VECTOR_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define SIMPLE_VECTOR_TARGET_AVX2
+#endif
+
+//         .
+//   ,   ;    
+template <typename Type>
+struct IsBitwiseComparable : std::bool_constant<std::is_integral_v<Type> || std::is_enum_v<Type> || std::is_pointer_v<Type>> {
+};
+
+template <typename Type>
+inline constexpr bool IsBitwiseComparableV = IsBitwiseComparable<Type>::value;
+
+namespace simd {
+
+namespace detail {
+
+    //  ,     
+    template <typename Type>
+    inline constexpr bool IsLaneSizeV = sizeof(Type) == 1 || sizeof(Type) == 2 || sizeof(Type) == 4 || sizeof(Type) == 8;
+
+    template <typename Type>
+    inline constexpr bool IsSumTypeV = std::is_same_v<Type, float> || std::is_same_v<Type, double>
+        || (std::is_integral_v<Type> && !std::is_same_v<Type, bool> && (sizeof(Type) == 4 || sizeof(Type) == 8));
+
+    template <typename Type>
+    inline constexpr bool IsMinMaxTypeV = std::is_same_v<Type, float> || std::is_same_v<Type, double>
+        || std::is_same_v<Type, int32_t>;
+
+#if defined(SIMPLE_VECTOR_X86_SIMD)
+
+    inline bool DetectAvx2() noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+        int regs[4];
+        __cpuid(regs, 1);
+        const bool os_saves_ymm = (regs[2] & (1 << 27)) && (_xgetbv(0) & 0x6) == 0x6;
+        __cpuidex(regs, 7, 0);
+        return os_saves_ymm && (regs[1] & (1 << 5));
+#else
+        return __builtin_cpu_supports("avx2");
+#endif
+    }
+
+    inline bool HasAvx2() noexcept {
+        static const bool has_avx2 = DetectAvx2();
+        return has_avx2;
+    }
+
+    inline unsigned CountTrailingZeros(uint32_t mask) noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+        unsigned long index;
+        _BitScanForward(&index, mask);
+        return index;
+#else
+        return __builtin_ctz(mask);
+#endif
+    }
+
+    inline unsigned PopCount(uint32_t mask) noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+        mask = mask - ((mask >> 1) & 0x55555555u);
+        mask = (mask & 0x33333333u) + ((mask >> 2) & 0x33333333u);
+        return (((mask + (mask >> 4)) & 0x0F0F0F0Fu) * 0x01010101u) >> 24;
+#else
+        return __builtin_popcount(mask);
+#endif
+    }
+
+    // ---------- SSE2 ----------
+
+    template <size_t Size>
+    inline __m128i BroadcastSse2(const void* value) noexcept {
+        if constexpr (Size == 1) {
+            int8_t lane;
+            std::memcpy(&lane, value, Size);
+            return _mm_set1_epi8(lane);
+        }
+        else if constexpr (Size == 2) {
+            int16_t lane;
+            std::memcpy(&lane, value, Size);
+            return _mm_set1_epi16(lane);
+        }
+        else if constexpr (Size == 4) {
+            int32_t lane;
+            std::memcpy(&lane, value, Size);
+            return _mm_set1_epi32(lane);
+        }
+        else {
+            int64_t lane;
+            std::memcpy(&lane, value, Size);
+            return _mm_set1_epi64x(lane);
+        }
+    }
+
+    //    :     Size  
+    template <size_t Size>
+    inline uint32_t EqualMaskSse2(__m128i lhs, __m128i rhs) noexcept {
+        if constexpr (Size == 1) {
+            return _mm_movemask_epi8(_mm_cmpeq_epi8(lhs, rhs));
+        }
+        else if constexpr (Size == 2) {
+            return _mm_movemask_epi8(_mm_cmpeq_epi16(lhs, rhs));
+        }
+        else if constexpr (Size == 4) {
+            return _mm_movemask_epi8(_mm_cmpeq_epi32(lhs, rhs));
+        }
+        else {
+            //  SSE2   64- :  32-   
+            __m128i equal = _mm_cmpeq_epi32(lhs, rhs);
+            equal = _mm_and_si128(equal, _mm_shuffle_epi32(equal, _MM_SHUFFLE(2, 3, 0, 1)));
+            return _mm_movemask_epi8(equal);
+        }
+    }
+
+    template <size_t Size>
+    size_t FindSse2(const unsigned char* data, size_t count, const void* value) noexcept {
+        const __m128i needle = BroadcastSse2<Size>(value);
+        size_t i = 0;
+        for (; i + 16 / Size <= count; i += 16 / Size) {
+            const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i * Size));
+            const uint32_t mask = EqualMaskSse2<Size>(block, needle);
+            if (mask != 0) {
+                return i + CountTrailingZeros(mask) / Size;
+            }
+        }
+        for (; i < count && std::memcmp(data + i * Size, value, Size) != 0; ++i) {
+        }
+        return i;
+    }
+
+    template <size_t Size>
+    size_t CountSse2(const unsigned char* data, size_t count, const void* value) noexcept {
+        const __m128i needle = BroadcastSse2<Size>(value);
+        size_t result = 0;
+        size_t i = 0;
+        for (; i + 16 / Size <= count; i += 16 / Size) {
+            const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i * Size));
+            result += PopCount(EqualMaskSse2<Size>(block, needle)) / Size;
+        }
+        for (; i < count; ++i) {
+            result += std::memcmp(data + i * Size, value, Size) == 0;
+        }
+        return result;
+    }
+
+    template <size_t Size>
+    void FillSse2(unsigned char* data, size_t count, const void* value) noexcept {
+        const __m128i pattern = BroadcastSse2<Size>(value);
+        size_t i = 0;
+        for (; i + 16 / Size <= count; i += 16 / Size) {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(data + i * Size), pattern);
+        }
+        for (; i < count; ++i) {
+            std::memcpy(data + i * Size, value, Size);
+        }
+    }
+
+    //      bytes,   
+    inline size_t MismatchSse2(const unsigned char* lhs, const unsigned char* rhs, size_t bytes) noexcept {
+        size_t i = 0;
+        for (; i + 16 <= bytes; i += 16) {
+            const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + i));
+            const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + i));
+            const uint32_t mask = ~static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(a, b))) & 0xFFFFu;
+            if (mask != 0) {
+                return i + CountTrailingZeros(mask);
+            }
+        }
+        for (; i < bytes && lhs[i] == rhs[i]; ++i) {
+        }
+        return i;
+    }
+
+    template <typename Type>
+    Type SumSse2(const Type* data, size_t count) noexcept {
+        size_t i = 0;
+        Type lanes[16 / sizeof(Type)];
+        if constexpr (std::is_same_v<Type, float>) {
+            __m128 acc = _mm_setzero_ps();
+            for (; i + 4 <= count; i += 4) {
+                acc = _mm_add_ps(acc, _mm_loadu_ps(data + i));
+            }
+            _mm_storeu_ps(lanes, acc);
+        }
+        else if constexpr (std::is_same_v<Type, double>) {
+            __m128d acc = _mm_setzero_pd();
+            for (; i + 2 <= count; i += 2) {
+                acc = _mm_add_pd(acc, _mm_loadu_pd(data + i));
+            }
+            _mm_storeu_pd(lanes, acc);
+        }
+        else {
+            __m128i acc = _mm_setzero_si128();
+            for (; i + 16 / sizeof(Type) <= count; i += 16 / sizeof(Type)) {
+                const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+                acc = sizeof(Type) == 4 ? _mm_add_epi32(acc, block) : _mm_add_epi64(acc, block);
+            }
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), acc);
+        }
+        using Acc = std::conditional_t<std::is_integral_v<Type>, std::make_unsigned_t<std::conditional_t<std::is_integral_v<Type>, Type, int>>, Type>;
+        Acc result = 0;
+        for (Type lane : lanes) {
+            result += static_cast<Acc>(lane);
+        }
+        for (; i < count; ++i) {
+            result += static_cast<Acc>(data[i]);
+        }
+        return static_cast<Type>(result);
+    }
+
+    template <typename Type>
+    std::pair<Type, Type> MinMaxSse2(const Type* data, size_t count) noexcept {
+        Type min = data[0];
+        Type max = data[0];
+        size_t i = 0;
+        Type min_lanes[16 / sizeof(Type)];
+        Type max_lanes[16 / sizeof(Type)];
+        if constexpr (std::is_same_v<Type, float>) {
+            __m128 min_acc = _mm_set1_ps(min);
+            __m128 max_acc = min_acc;
+            for (; i + 4 <= count; i += 4) {
+                const __m128 block = _mm_loadu_ps(data + i);
+                min_acc = _mm_min_ps(min_acc, block);
+                max_acc = _mm_max_ps(max_acc, block);
+            }
+            _mm_storeu_ps(min_lanes, min_acc);
+            _mm_storeu_ps(max_lanes, max_acc);
+        }
+        else if constexpr (std::is_same_v<Type, double>) {
+            __m128d min_acc = _mm_set1_pd(min);
+            __m128d max_acc = min_acc;
+            for (; i + 2 <= count; i += 2) {
+                const __m128d block = _mm_loadu_pd(data + i);
+                min_acc = _mm_min_pd(min_acc, block);
+                max_acc = _mm_max_pd(max_acc, block);
+            }
+            _mm_storeu_pd(min_lanes, min_acc);
+            _mm_storeu_pd(max_lanes, max_acc);
+        }
+        else {
+            //  SSE2  min/max  32- ,     
+            __m128i min_acc = _mm_set1_epi32(min);
+            __m128i max_acc = min_acc;
+            for (; i + 4 <= count; i += 4) {
+                const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+                const __m128i less = _mm_cmplt_epi32(block, min_acc);
+                min_acc = _mm_or_si128(_mm_and_si128(less, block), _mm_andnot_si128(less, min_acc));
+                const __m128i greater = _mm_cmpgt_epi32(block, max_acc);
+                max_acc = _mm_or_si128(_mm_and_si128(greater, block), _mm_andnot_si128(greater, max_acc));
+            }
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(min_lanes), min_acc);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(max_lanes), max_acc);
+        }
+        for (size_t lane = 0; lane < 16 / sizeof(Type); ++lane) {
+            min = std::min(min, min_lanes[lane]);
+            max = std::max(max, max_lanes[lane]);
+        }
+        for (; i < count; ++i) {
+            min = std::min(min, data[i]);
+            max = std::max(max, data[i]);
+        }
+        return { min, max };
+    }
+
+    // ---------- AVX2 ----------
+
+    template <size_t Size>
+    SIMPLE_VECTOR_TARGET_AVX2 inline __m256i BroadcastAvx2(const void* value) noexcept {
+        if constexpr (Size == 1) {
+            int8_t lane;
+            std::memcpy(&lane, value, Size);
+            return _mm256_set1_epi8(lane);
+        }
+        else if constexpr (Size == 2) {
+            int16_t lane;
+            std::memcpy(&lane, value, Size);
+            return _mm256_set1_epi16(lane);
+        }
+        else if constexpr (Size == 4) {
+            int32_t lane;
+            std::memcpy(&lane, value, Size);
+            return _mm256_set1_epi32(lane);
+        }
+        else {
+            int64_t lane;
+            std::memcpy(&lane, value, Size);
+            return _mm256_set1_epi64x(lane);
+        }
+    }
+
+    template <size_t Size>
+    SIMPLE_VECTOR_TARGET_AVX2 inline uint32_t EqualMaskAvx2(__m256i lhs, __m256i rhs) noexcept {
+        if constexpr (Size == 1) {
+            return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(lhs, rhs)));
+        }
+        else if constexpr (Size == 2) {
+            return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi16(lhs, rhs)));
+        }
+        else if constexpr (Size == 4) {
+            return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi32(lhs, rhs)));
+        }
+        else {
+            return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi64(lhs, rhs)));
+        }
+    }
+
+    template <size_t Size>
+    SIMPLE_VECTOR_TARGET_AVX2 size_t FindAvx2(const unsigned char* data, size_t count, const void* value) noexcept {
+        const __m256i needle = BroadcastAvx2<Size>(value);
+        size_t i = 0;
+        for (; i + 32 / Size <= count; i += 32 / Size) {
+            const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i * Size));
+            const uint32_t mask = EqualMaskAvx2<Size>(block, needle);
+            if (mask != 0) {
+                return i + CountTrailingZeros(mask) / Size;
+            }
+        }
+        for (; i < count && std::memcmp(data + i * Size, value, Size) != 0; ++i) {
+        }
+        return i;
+    }
+
+    template <size_t Size>
+    SIMPLE_VECTOR_TARGET_AVX2 size_t CountAvx2(const unsigned char* data, size_t count, const void* value) noexcept {
+        const __m256i needle = BroadcastAvx2<Size>(value);
+        size_t result = 0;
+        size_t i = 0;
+        for (; i + 32 / Size <= count; i += 32 / Size) {
+            const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i * Size));
+            result += PopCount(EqualMaskAvx2<Size>(block, needle)) / Size;
+        }
+        for (; i < count; ++i) {
+            result += std::memcmp(data + i * Size, value, Size) == 0;
+        }
+        return result;
+    }
+
+    template <size_t Size>
+    SIMPLE_VECTOR_TARGET_AVX2 void FillAvx2(unsigned char* data, size_t count, const void* value) noexcept {
+        const __m256i pattern = BroadcastAvx2<Size>(value);
+        size_t i = 0;
+        for (; i + 32 / Size <= count; i += 32 / Size) {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(data + i * Size), pattern);
+        }
+        for (; i < count; ++i) {
+            std::memcpy(data + i * Size, value, Size);
+        }
+    }
+
+    SIMPLE_VECTOR_TARGET_AVX2 inline size_t MismatchAvx2(const unsigned char* lhs, const unsigned char* rhs, size_t bytes) noexcept {
+        size_t i = 0;
+        for (; i + 32 <= bytes; i += 32) {
+            const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs + i));
+            const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs + i));
+            const uint32_t mask = ~static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b)));
+            if (mask != 0) {
+                return i + CountTrailingZeros(mask);
+            }
+        }
+        for (; i < bytes && lhs[i] == rhs[i]; ++i) {
+        }
+        return i;
+    }
+
+    template <typename Type>
+    SIMPLE_VECTOR_TARGET_AVX2 Type SumAvx2(const Type* data, size_t count) noexcept {
+        size_t i = 0;
+        Type lanes[32 / sizeof(Type)];
+        if constexpr (std::is_same_v<Type, float>) {
+            __m256 acc = _mm256_setzero_ps();
+            for (; i + 8 <= count; i += 8) {
+                acc = _mm256_add_ps(acc, _mm256_loadu_ps(data + i));
+            }
+            _mm256_storeu_ps(lanes, acc);
+        }
+        else if constexpr (std::is_same_v<Type, double>) {
+            __m256d acc = _mm256_setzero_pd();
+            for (; i + 4 <= count; i += 4) {
+                acc = _mm256_add_pd(acc, _mm256_loadu_pd(data + i));
+            }
+            _mm256_storeu_pd(lanes, acc);
+        }
+        else {
+            __m256i acc = _mm256_setzero_si256();
+            for (; i + 32 / sizeof(Type) <= count; i += 32 / sizeof(Type)) {
+                const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+                acc = sizeof(Type) == 4 ? _mm256_add_epi32(acc, block) : _mm256_add_epi64(acc, block);
+            }
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), acc);
+        }
+        using Acc = std::conditional_t<std::is_integral_v<Type>, std::make_unsigned_t<std::conditional_t<std::is_integral_v<Type>, Type, int>>, Type>;
+        Acc result = 0;
+        for (Type lane : lanes) {
+            result += static_cast<Acc>(lane);
+        }
+        for (; i < count; ++i) {
+            result += static_cast<Acc>(data[i]);
+        }
+        return static_cast<Type>(result);
+    }
+
+    template <typename Type>
+    SIMPLE_VECTOR_TARGET_AVX2 std::pair<Type, Type> MinMaxAvx2(const Type* data, size_t count) noexcept {
+        Type min = data[0];
+        Type max = data[0];
+        size_t i = 0;
+        Type min_lanes[32 / sizeof(Type)];
+        Type max_lanes[32 / sizeof(Type)];
+        if constexpr (std::is_same_v<Type, float>) {
+            __m256 min_acc = _mm256_set1_ps(min);
+            __m256 max_acc = min_acc;
+            for (; i + 8 <= count; i += 8) {
+                const __m256 block = _mm256_loadu_ps(data + i);
+                min_acc = _mm256_min_ps(min_acc, block);
+                max_acc = _mm256_max_ps(max_acc, block);
+            }
+            _mm256_storeu_ps(min_lanes, min_acc);
+            _mm256_storeu_ps(max_lanes, max_acc);
+        }
+        else if constexpr (std::is_same_v<Type, double>) {
+            __m256d min_acc = _mm256_set1_pd(min);
+            __m256d max_acc = min_acc;
+            for (; i + 4 <= count; i += 4) {
+                const __m256d block = _mm256_loadu_pd(data + i);
+                min_acc = _mm256_min_pd(min_acc, block);
+                max_acc = _mm256_max_pd(max_acc, block);
+            }
+            _mm256_storeu_pd(min_lanes, min_acc);
+            _mm256_storeu_pd(max_lanes, max_acc);
+        }
+        else {
+            __m256i min_acc = _mm256_set1_epi32(min);
+            __m256i max_acc = min_acc;
+            for (; i + 8 <= count; i += 8) {
+                const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+                min_acc = _mm256_min_epi32(min_acc, block);
+                max_acc = _mm256_max_epi32(max_acc, block);
+            }
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(min_lanes), min_acc);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(max_lanes), max_acc);
+        }
+        for (size_t lane = 0; lane < 32 / sizeof(Type); ++lane) {
+            min = std::min(min, min_lanes[lane]);
+            max = std::max(max, max_lanes[lane]);
+        }
+        for (; i < count; ++i) {
+            min = std::min(min, data[i]);
+            max = std::max(max, data[i]);
+        }
+        return { min, max };
+    }
+
+#endif // SIMPLE_VECTOR_X86_SIMD
+
+    //          count
+    template <typename Type>
+    size_t MismatchIndex(const Type* lhs, const Type* rhs, size_t count) noexcept {
+#if defined(SIMPLE_VECTOR_X86_SIMD)
+        const auto* a = reinterpret_cast<const unsigned char*>(lhs);
+        const auto* b = reinterpret_cast<const unsigned char*>(rhs);
+        const size_t bytes = count * sizeof(Type);
+        const size_t offset = HasAvx2() ? MismatchAvx2(a, b, bytes) : MismatchSse2(a, b, bytes);
+        return offset / sizeof(Type);
+#else
+        return std::mismatch(lhs, lhs + count, rhs).first - lhs;
+#endif
+    }
+
+} // namespace detail
+
+//  value   [first, last)
+template <typename Type>
+void Fill(Type* first, Type* last, const Type& value) {
+    if constexpr (std::is_trivially_copyable_v<Type> && sizeof(Type) == 1) {
+        if (first != last) {
+            std::memset(static_cast<void*>(first), *reinterpret_cast<const unsigned char*>(&value), last - first);
+        }
+    }
+#if defined(SIMPLE_VECTOR_X86_SIMD)
+    else if constexpr (std::is_trivially_copyable_v<Type> && detail::IsLaneSizeV<Type>) {
+        auto* data = reinterpret_cast<unsigned char*>(first);
+        if (detail::HasAvx2()) {
+            detail::FillAvx2<sizeof(Type)>(data, last - first, &value);
+        }
+        else {
+            detail::FillSse2<sizeof(Type)>(data, last - first, &value);
+        }
+    }
+#endif
+    else {
+        std::fill(first, last, value);
+    }
+}
+
+//     [first, last),  value,  last
+template <typename Type>
+const Type* Find(const Type* first, const Type* last, const Type& value) {
+#if defined(SIMPLE_VECTOR_X86_SIMD)
+    if constexpr (IsBitwiseComparableV<Type> && detail::IsLaneSizeV<Type>) {
+        const auto* data = reinterpret_cast<const unsigned char*>(first);
+        return first + (detail::HasAvx2()
+            ? detail::FindAvx2<sizeof(Type)>(data, last - first, &value)
+            : detail::FindSse2<sizeof(Type)>(data, last - first, &value));
+    }
+    else
+#endif
+    {
+        return std::find(first, last, value);
+    }
+}
+
+//   [first, last),  value
+template <typename Type>
+size_t Count(const Type* first, const Type* last, const Type& value) {
+#if defined(SIMPLE_VECTOR_X86_SIMD)
+    if constexpr (IsBitwiseComparableV<Type> && detail::IsLaneSizeV<Type>) {
+        const auto* data = reinterpret_cast<const unsigned char*>(first);
+        return detail::HasAvx2()
+            ? detail::CountAvx2<sizeof(Type)>(data, last - first, &value)
+            : detail::CountSse2<sizeof(Type)>(data, last - first, &value);
+    }
+    else
+#endif
+    {
+        return static_cast<size_t>(std::count(first, last, value));
+    }
+}
+
+//  .      2^N    ,
+//          
+template <typename Type>
+Type Sum(const Type* first, const Type* last) {
+#if defined(SIMPLE_VECTOR_X86_SIMD)
+    if constexpr (detail::IsSumTypeV<Type>) {
+        using Lane = std::conditional_t<std::is_integral_v<Type>, std::make_signed_t<std::conditional_t<std::is_integral_v<Type>, Type, int>>, Type>;
+        const auto* data = reinterpret_cast<const Lane*>(first);
+        return static_cast<Type>(detail::HasAvx2() ? detail::SumAvx2(data, last - first) : detail::SumSse2(data, last - first));
+    }
+    else
+#endif
+    if constexpr (std::is_integral_v<Type> && !std::is_same_v<Type, bool>) {
+        using Acc = std::make_unsigned_t<Type>;
+        Acc result = 0;
+        for (; first != last; ++first) {
+            result += static_cast<Acc>(*first);
+        }
+        return static_cast<Type>(result);
+    }
+    else {
+        return std::accumulate(first, last, Type{});
+    }
+}
+
+//      .   NaN   
+template <typename Type>
+std::pair<Type, Type> MinMax(const Type* first, const Type* last) {
+    assert(first != last);
+#if defined(SIMPLE_VECTOR_X86_SIMD)
+    if constexpr (detail::IsMinMaxTypeV<Type>) {
+        return detail::HasAvx2() ? detail::MinMaxAvx2(first, last - first) : detail::MinMaxSse2(first, last - first);
+    }
+    else
+#endif
+    {
+        const auto [min, max] = std::minmax_element(first, last);
+        return { *min, *max };
+    }
+}
+
+template <typename Type>
+bool Equal(const Type* first1, const Type* last1, const Type* first2, const Type* last2) {
+    if constexpr (IsBitwiseComparableV<Type>) {
+        return last1 - first1 == last2 - first2
+            && (first1 == last1 || std::memcmp(first1, first2, (last1 - first1) * sizeof(Type)) == 0);
+    }
+    else {
+        return std::equal(first1, last1, first2, last2);
+    }
+}
+
+//  :     ,    
+template <typename Type>
+bool LexicographicalLess(const Type* first1, const Type* last1, const Type* first2, const Type* last2) {
+    if constexpr (IsBitwiseComparableV<Type>) {
+        const size_t size1 = last1 - first1;
+        const size_t size2 = last2 - first2;
+        const size_t common = std::min(size1, size2);
+        const size_t index = common == 0 ? 0 : detail::MismatchIndex(first1, first2, common);
+        if (index == common) {
+            return size1 < size2;
+        }
+        return first1[index] < first2[index];
+    }
+    else {
+        return std::lexicographical_compare(first1, last1, first2, last2);
+    }
+}
+
+} // namespace simd
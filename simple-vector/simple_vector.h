@@ -2,11 +2,21 @@
 
 #include <cassert>
 #include <initializer_list>
+#include <iterator>
 #include <iostream>
 #include <algorithm>
+#include <cstring>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
 #include <utility>
 
 #include "array_ptr.h"
+#include "check_policy.h"
+#include "growth_policy.h"
+#include "simd_kernels.h"
+#include "stats.h"
 
 
 class ReserveProxyObj {
@@ -27,69 +37,130 @@ private:
     size_t void_capacity_ = 0u;
 };
 
-ReserveProxyObj Reserve(size_t capacity_to_reserve) {
+inline ReserveProxyObj Reserve(size_t capacity_to_reserve) {
     return ReserveProxyObj(capacity_to_reserve);
 }
 
-template <typename Type>
-class SimpleVector {
+//     ,       (Insert(pos, 3, 5))
+template <typename It>
+using RequireInputIterator = std::enable_if_t<std::is_convertible_v<
+    typename std::iterator_traits<It>::iterator_category, std::input_iterator_tag>>;
+
+template <typename It>
+inline constexpr bool IsForwardIteratorV = std::is_convertible_v<
+    typename std::iterator_traits<It>::iterator_category, std::forward_iterator_tag>;
+
+// CheckPolicy       (. check_policy.h).  
+//     ,      -  
+template <typename Type, typename Allocator = std::allocator<Type>, typename GrowthPolicy = DoublingGrowth,
+          typename CheckPolicy = AssertPolicy>
+class SimpleVector : public check_detail::Generation<CheckPolicy::kCheckedIterators> {
+    using AllocTraits = std::allocator_traits<Allocator>;
+    static constexpr bool kCheckedIterators = CheckPolicy::kCheckedIterators;
+
 public:
-    using Iterator = Type*;
-    using ConstIterator = const Type*;
+    using Iterator = std::conditional_t<kCheckedIterators,
+        CheckedIterator<SimpleVector, Type, CheckPolicy>, Type*>;
+    using ConstIterator = std::conditional_t<kCheckedIterators,
+        CheckedIterator<SimpleVector, const Type, CheckPolicy>, const Type*>;
+
+    SimpleVector() noexcept(noexcept(Allocator())) = default;
 
-    SimpleVector() noexcept = default;
+    explicit SimpleVector(const Allocator& alloc) noexcept :
+        items_(alloc) {
+    }
+
+    explicit SimpleVector(size_t size, const Allocator& alloc = Allocator()) :
+        items_(ArrayPtr<Type, Allocator>::MakeValueInitialized(size, alloc)) {
+        size_ = size;
+    }
 
-    explicit SimpleVector(size_t size) : 
-        size_(size), capacity_(size), items_(size) {
+    explicit SimpleVector(ReserveProxyObj obj, const Allocator& alloc = Allocator()) :
+        items_(obj.GetVoid(), alloc) {
     }
 
-    explicit SimpleVector(ReserveProxyObj obj) :
-        size_(0u), capacity_(obj.GetVoid()), items_(obj.GetVoid()) {
+    SimpleVector(size_t size, const Type& value, const Allocator& alloc = Allocator()) :
+        items_(size, alloc) {
+        items_.UninitializedFill(items_.Get(), size, value);
+        size_ = size;
     }
 
-    SimpleVector(size_t size, const Type& value) :
-        size_(size), capacity_(size), items_(size) {
-        std::fill(begin(), end(), value);
+    SimpleVector(std::initializer_list<Type> init, const Allocator& alloc = Allocator()) :
+        items_(init.size(), alloc) {
+        items_.UninitializedCopy(init.begin(), init.end(), items_.Get());
+        size_ = init.size();
     }
 
-    SimpleVector(std::initializer_list<Type> init) :
-        size_(init.size()), capacity_(init.size()), items_(init.size()) {
-        std::copy(init.begin(), init.end(), begin());
+    template <typename InputIt, typename = RequireInputIterator<InputIt>>
+    SimpleVector(InputIt first, InputIt last, const Allocator& alloc = Allocator()) :
+        items_(alloc) {
+        Append(first, last);
     }
 
-    SimpleVector(const SimpleVector& other) : 
-        size_(other.GetSize()), capacity_(other.GetSize()), items_(other.GetSize()) {
-        std::copy(other.begin(), other.end(), begin());
+    SimpleVector(const SimpleVector& other) :
+        SimpleVector(other, AllocTraits::select_on_container_copy_construction(other.GetAllocator())) {
+    }
+
+    SimpleVector(const SimpleVector& other, const Allocator& alloc) :
+        items_(other.GetSize(), alloc) {
+        items_.UninitializedCopy(other.Data(), other.Data() + other.size_, items_.Get());
+        size_ = other.GetSize();
     }
 
     SimpleVector(SimpleVector&& other) noexcept :
-        capacity_{ std::exchange(other.capacity_, 0) },
-        size_{std::exchange(other.size_, 0)}, items_(std::move(other.items_)) {
-    } 
+        size_{ std::exchange(other.size_, 0) }, items_(std::move(other.items_)) {
+        other.Invalidate();
+    }
+
+    ~SimpleVector() {
+        items_.Destroy(Data(), DataEnd());
+    }
 
     SimpleVector& operator=(const SimpleVector& rhs) {
         if (this != &rhs) {
-            SimpleVector tmp(rhs);
-            swap(tmp);
-        }  
+            if constexpr (AllocTraits::propagate_on_container_copy_assignment::value) {
+                *this = SimpleVector(rhs, rhs.GetAllocator());
+            }
+            else {
+                SimpleVector tmp(rhs, GetAllocator());
+                swap(tmp);
+            }
+        }
         return *this;
     }
 
-    SimpleVector& operator=(SimpleVector&& rhs) {
+    SimpleVector& operator=(SimpleVector&& rhs) noexcept(AllocTraits::propagate_on_container_move_assignment::value
+                                                         || AllocTraits::is_always_equal::value) {
         if (this != &rhs) {
-            items_ = std::move(rhs.items_);
-            size_ = std::exchange(rhs.size_, 0);
-            capacity_ = std::exchange(rhs.capacity_, 0);
-        } 
+            if (AllocTraits::propagate_on_container_move_assignment::value || GetAllocator() == rhs.GetAllocator()) {
+                Clear();
+                items_ = std::move(rhs.items_);
+                size_ = std::exchange(rhs.size_, 0);
+                this->Invalidate();
+                rhs.Invalidate();
+            }
+            else {
+                //     -      ,     
+                SimpleVector tmp(GetAllocator());
+                tmp.Reserve(rhs.GetSize());
+                tmp.items_.UninitializedCopy(std::make_move_iterator(rhs.Data()), std::make_move_iterator(rhs.Data() + rhs.size_), tmp.Data());
+                tmp.size_ = rhs.GetSize();
+                swap(tmp);
+            }
+        }
         return *this;
     }
 
+    Allocator GetAllocator() const noexcept {
+        return items_.GetAllocator();
+    }
+
     size_t GetSize() const noexcept {
         return size_;
     }
 
     size_t GetCapacity() const noexcept {
-        return capacity_;
+        return items_.GetSize();
     }
 
     bool IsEmpty() const noexcept {
@@ -97,13 +168,13 @@ public:
     }
 
     Type& operator[](size_t index) noexcept {
-        assert(index < size_);
+        CheckPolicy::Check(index < size_, "index is out of range");
         return items_[index];
     }
 
     const Type& operator[](size_t index) const noexcept {
-        assert(index < size_);
-        return const_cast<Type>(items_[index]);
+        CheckPolicy::Check(index < size_, "index is out of range");
+        return items_[index];
     }
 
     Type& At(size_t index) {
@@ -125,233 +196,298 @@ public:
     }
 
     void Clear() noexcept {
+        items_.Destroy(Data(), DataEnd());
         size_ = 0u;
     }
 
+    //    ,  -      
     void Resize(size_t new_size) {
         if (new_size == size_) {
             return;
         }
         else if (new_size < size_) {
+            items_.Destroy(Data() + new_size, DataEnd());
+            size_ = new_size;
+        }
+        else if (size_ == 0 && new_size > GetCapacity()) {
+            //       -       
+            items_ = ArrayPtr<Type, Allocator>::MakeValueInitialized(new_size, items_.GetAllocator());
             size_ = new_size;
+            this->Invalidate();
         }
         else {
-            if (new_size <= capacity_) {
-                ArrayPtr<Type> new_size_(new Type[new_size]{ 0 });
-                std::move(begin(), end(), new_size_.Get());
-
-                items_.swap(new_size_);
-                size_ = new_size;
-            }
-            else {
-                ArrayPtr<Type> new_size_(new Type[new_size]{ 0 });
-                std::move(begin(), end(), new_size_.Get());
+            Reserve(new_size);
+            items_.UninitializedFill(DataEnd(), new_size - size_);
+            size_ = new_size;
+        }
+        stats::RecordSize<Type>(size_, GetCapacity());
+    }
 
-                items_.swap(new_size_);
-                size_ = new_size;
-                capacity_ = new_size;
-            }
+    //  ,    :    (,   ).
+    //     ,   PushBack
+    void ResizeUninitialized(size_t new_size) {
+        static_assert(std::is_trivially_copyable_v<Type>, "ResizeUninitialized requires a trivially copyable type");
+        if (new_size > GetCapacity()) {
+            Reserve(NextCapacity(new_size));
         }
+        size_ = new_size;
     }
 
     void Reserve(size_t new_capacity) {
-        if (new_capacity <= capacity_) {
+        if (new_capacity <= GetCapacity()) {
             return;
         }
+        stats::RecordGrowth<Type>(GetCapacity(), size_);
+        if constexpr (IsTriviallyRelocatableV<Type>) {
+            items_.Reallocate(new_capacity, size_);
+        }
         else {
-            ArrayPtr<Type> new_vec_(new Type[new_capacity]{ 0 });
-            std::move(begin(), end(), new_vec_.Get());
+            ArrayPtr<Type, Allocator> new_vec_(new_capacity, items_.GetAllocator());
+            TransferItems(new_vec_, Data(), DataEnd(), new_vec_.Get());
+            items_.Destroy(Data(), DataEnd());
 
-            capacity_ = new_capacity;
             items_.swap(new_vec_);
         }
+        this->Invalidate();
+        stats::RecordSize<Type>(size_, GetCapacity());
     }
 
-    Iterator begin() noexcept {
+    //   ,       GetSize() 
+    void ShrinkToFit() {
+        if (size_ == GetCapacity()) {
+            return;
+        }
+        else if constexpr (IsTriviallyRelocatableV<Type>) {
+            items_.Reallocate(size_, size_);
+        }
+        else {
+            ArrayPtr<Type, Allocator> new_vec_(size_, items_.GetAllocator());
+            TransferItems(new_vec_, Data(), DataEnd(), new_vec_.Get());
+            items_.Destroy(Data(), DataEnd());
+
+            items_.swap(new_vec_);
+        }
+        this->Invalidate();
+    }
+
+    //        ,    
+    Type* Data() noexcept {
+        return items_.Get();
+    }
+
+    const Type* Data() const noexcept {
         return items_.Get();
     }
 
+    Iterator begin() noexcept {
+        return MakeIterator(Data());
+    }
+
     Iterator end() noexcept {
-        return items_.Get() + size_;
+        return MakeIterator(DataEnd());
     }
 
     ConstIterator begin() const noexcept {
-        return items_.Get();
+        return MakeIterator(Data());
     }
 
     ConstIterator end() const noexcept {
-        return items_.Get() + size_;
+        return MakeIterator(DataEnd());
     }
 
     ConstIterator cbegin() const noexcept {
-        return items_.Get();
+        return begin();
     }
 
     ConstIterator cend() const noexcept {
-        return items_.Get() + size_;
+        return end();
     }
 
     //  Push_Back
     void PushBack(const Type& item) {
-        if (IsEmpty() && capacity_ == 0) {
-            ArrayPtr<Type> new_size_vec_(new Type[1]{ item });
-            items_.swap(new_size_vec_);
-            size_ = 1;
-            capacity_ = size_;
-        }
-        else {
-            if (size_ >= capacity_) {
-                Reserve(capacity_ * 2);
-            }
-            items_[size_] = item;
-            size_++;
-        } 
+        EmplaceAt(size_, item);
     }
 
     //  Push_Back
     void PushBack(Type&& item) {
-        if (IsEmpty() && capacity_ == 0) {
-            ArrayPtr<Type> new_size_vec_(new Type[1]{0});
-            std::swap(item, new_size_vec_[0]);
-            items_.swap(new_size_vec_);
-            size_ = 1;
-            capacity_ = size_;
-        }
-        else {
-            if (size_ >= capacity_) {
-                Reserve(capacity_ * 2);
-            }
-            items_[size_] = std::move(item);
-            size_++;
-        }
+        EmplaceAt(size_, std::move(item));
     }
 
-    Iterator Insert(ConstIterator pos, const Type& value) {
-
-        assert(pos >= cbegin());
-        assert(pos <= cend());
-
-        if (IsEmpty()) {
-            PushBack(value);
-            return begin();
-        }
-        else if (pos == end()) {
-            PushBack(value);
-            return (end() - 1);
-        }
-        else if (size_ < capacity_) {
-            std::move_backward(pos, end(), end() + 1);
-            *pos = value;
-            size_++;
-
-            return pos;
-        }
-        else {
-            auto distance = std::distance(begin(), pos);
-            Reserve(capacity_ * 2);
+    //    args    
+    template <typename... Args>
+    Type& EmplaceBack(Args&&... args) {
+        return *EmplaceAt(size_, std::forward<Args>(args)...);
+    }
 
-            std::move_backward(begin() + distance, end(), end() + 1);
-            *(begin() + distance) = value;
-            size_++;
+    //    args    pos
+    template <typename... Args>
+    Iterator Emplace(ConstIterator pos, Args&&... args) {
+        return MakeIterator(EmplaceAt(IndexOf(pos), std::forward<Args>(args)...));
+    }
 
-            return begin() + distance;
-        }
+    Iterator Insert(ConstIterator pos, const Type& value) {
+        return MakeIterator(EmplaceAt(IndexOf(pos), value));
     }
 
     //  Insert
-    Iterator Insert(Iterator pos, Type&& value) {
-
-        assert(pos >= begin());
-        assert(pos <= end());
+    Iterator Insert(ConstIterator pos, Type&& value) {
+        return MakeIterator(EmplaceAt(IndexOf(pos), std::move(value)));
+    }
 
-        if (IsEmpty()) {
-            PushBack(std::move(value));
-            return begin();
+    //  count  value         
+    Iterator Insert(ConstIterator pos, size_t count, const Type& value) {
+        const size_t index = IndexOf(pos);
+        if (count == 0) {
+            return begin() + index;
         }
-        else if (pos == end()) {
-            PushBack(std::move(value));
-            return end() - 1;
+        // value       
+        Type tmp(value);
+        Type* gap = OpenGap(index, count);
+        try {
+            items_.UninitializedFill(gap, count, tmp);
         }
-        else if (size_ < capacity_) {
-
-            auto move_pos = std::make_move_iterator(pos);
-            auto move_end = std::make_move_iterator(end());
-
-            std::move_backward(move_pos, move_end, end() + 1);
-            std::swap(value, *pos);
-            size_++;
-
-            return pos;
+        catch (...) {
+            CloseGap(index, count);
+            throw;
+        }
+        size_ += count;
+        stats::RecordSize<Type>(size_, GetCapacity());
+        return MakeIterator(gap);
+    }
+
+    //  [first, last)   .  forward-   ,
+    //       .        
+    template <typename InputIt, typename = RequireInputIterator<InputIt>>
+    Iterator Insert(ConstIterator pos, InputIt first, InputIt last) {
+        const size_t index = IndexOf(pos);
+        if constexpr (IsForwardIteratorV<InputIt>) {
+            const size_t count = static_cast<size_t>(std::distance(first, last));
+            if (count == 0) {
+                return begin() + index;
+            }
+            Type* gap = OpenGap(index, count);
+            try {
+                items_.UninitializedCopy(first, last, gap);
+            }
+            catch (...) {
+                CloseGap(index, count);
+                throw;
+            }
+            size_ += count;
+            stats::RecordSize<Type>(size_, GetCapacity());
+            return MakeIterator(gap);
         }
         else {
-            auto distance = std::distance(begin(), pos);
-            Reserve(capacity_ * 2);
-            
-            auto move_pos = std::make_move_iterator(begin() + distance);
-            auto move_end = std::make_move_iterator(end());
-
-            std::move_backward(move_pos, move_end, end() + 1);
-            std::swap(value, *(begin() + distance));
-            size_++;
+            //    :        
+            const size_t old_size = size_;
+            for (; first != last; ++first) {
+                EmplaceBack(*first);
+            }
+            std::rotate(Data() + index, Data() + old_size, DataEnd());
+            return begin() + index;
+        }
+    }
 
-            return (begin() + distance);
+    //  [first, last)   
+    template <typename InputIt, typename = RequireInputIterator<InputIt>>
+    void Append(InputIt first, InputIt last) {
+        Insert(cend(), first, last);
+    }
+
+    //     [first, last)
+    template <typename InputIt, typename = RequireInputIterator<InputIt>>
+    void Assign(InputIt first, InputIt last) {
+        if constexpr (IsForwardIteratorV<InputIt>) {
+            const size_t count = static_cast<size_t>(std::distance(first, last));
+            if (count > GetCapacity()) {
+                ArrayPtr<Type, Allocator> new_vec_(count, items_.GetAllocator());
+                new_vec_.UninitializedCopy(first, last, new_vec_.Get());
+                Clear();
+                items_.swap(new_vec_);
+                size_ = count;
+                this->Invalidate();
+                return;
+            }
         }
+        Clear();
+        Append(first, last);
     }
 
     void PopBack() noexcept {
-        assert(!IsEmpty());
+        CheckPolicy::Check(!IsEmpty(), "PopBack on empty vector");
+        items_.Destroy(DataEnd() - 1, DataEnd());
         size_--;
     }
 
-    Iterator Erase(Iterator pos) {
+    //      
+    Iterator Erase(ConstIterator pos) {
+        Type* it_pos = Data() + IndexOf(pos);
+        CheckPolicy::Check(it_pos != DataEnd(), "erase position is end()");
 
-        assert(pos >= begin());
-        assert(pos <= end());
-        assert(!IsEmpty());
+        stats::RecordEraseShift<Type>(DataEnd() - it_pos - 1);
 
-        if (pos == (end() - 1)) {
-            PopBack();
-            return end();
+        if constexpr (IsTriviallyRelocatableV<Type>) {
+            items_.Destroy(it_pos, it_pos + 1);
+            std::memmove(static_cast<void*>(it_pos), static_cast<const void*>(it_pos + 1), (DataEnd() - it_pos - 1) * sizeof(Type));
+            size_--;
         }
         else {
-
-            auto move_pos_after = std::make_move_iterator(pos + 1);
-            auto move_end = std::make_move_iterator(end());
-
-            std::move(move_pos_after, move_end, pos);
-            size_--;
-
-            return pos;
+            std::move((it_pos + 1), DataEnd(), it_pos);
+            PopBack();
         }
-    }
 
-    //      
-    Iterator Erase(ConstIterator pos) {
+        return MakeIterator(it_pos);
+    }
 
-        assert(pos >= cbegin());
-        assert(pos <= cend());
-        assert(!IsEmpty());
+    //   [first, last)   
+    Iterator Erase(ConstIterator first, ConstIterator last) {
+        Type* it_first = Data() + IndexOf(first);
+        Type* it_last = Data() + IndexOf(last);
+        CheckPolicy::Check(it_first <= it_last, "erase range is reversed");
+        const size_t count = it_last - it_first;
+        stats::RecordEraseShift<Type>(DataEnd() - it_last);
 
-        if (pos == (cend() - 1)) {
-            PopBack();
-            return end();
+        if constexpr (IsTriviallyRelocatableV<Type>) {
+            items_.Destroy(it_first, it_last);
+            std::memmove(static_cast<void*>(it_first), static_cast<const void*>(it_last), (DataEnd() - it_last) * sizeof(Type));
         }
         else {
+            std::move(it_last, DataEnd(), it_first);
+            items_.Destroy(DataEnd() - count, DataEnd());
+        }
+        size_ -= count;
 
-            auto distance = std::distance(cbegin(), pos);
-            Iterator it_pos = begin() + distance;
+        return MakeIterator(it_first);
+    }
 
-            std::move((it_pos + 1), end(), it_pos);
-            size_--;
+    //    O(1),      .    
+    Iterator SwapErase(ConstIterator pos) {
+        Type* it_pos = Data() + IndexOf(pos);
+        CheckPolicy::Check(it_pos != DataEnd(), "erase position is end()");
+        Type* last = DataEnd() - 1;
 
-            return it_pos;
+        if constexpr (IsTriviallyRelocatableV<Type>) {
+            items_.Destroy(it_pos, it_pos + 1);
+            if (it_pos != last) {
+                std::memcpy(static_cast<void*>(it_pos), static_cast<const void*>(last), sizeof(Type));
+            }
+            size_--;
         }
+        else {
+            if (it_pos != last) {
+                *it_pos = std::move(*last);
+            }
+            PopBack();
+        }
+
+        return MakeIterator(it_pos);
     }
 
     void swap(SimpleVector& other) noexcept {
-        std::swap(this->capacity_, other.capacity_);
         std::swap(this->size_, other.size_);
         items_.swap(other.items_);
+        this->Invalidate();
+        other.Invalidate();
     }
 
     ////      int/double/char/string
@@ -364,43 +500,300 @@ public:
 
 private:
     size_t size_ = 0u;
-    size_t capacity_ = 0u;
 
-    ArrayPtr<Type> items_;
+    ArrayPtr<Type, Allocator> items_;
+
+    Type* DataEnd() noexcept {
+        return items_.Get() + size_;
+    }
+
+    const Type* DataEnd() const noexcept {
+        return items_.Get() + size_;
+    }
+
+    Iterator MakeIterator(Type* ptr) noexcept {
+        if constexpr (kCheckedIterators) {
+            return Iterator(this, ptr);
+        }
+        else {
+            return ptr;
+        }
+    }
+
+    ConstIterator MakeIterator(const Type* ptr) const noexcept {
+        if constexpr (kCheckedIterators) {
+            return ConstIterator(this, ptr);
+        }
+        else {
+            return ptr;
+        }
+    }
+
+    //   pos,     [begin, end]
+    size_t IndexOf(ConstIterator pos) const noexcept {
+        const Type* ptr = nullptr;
+        if constexpr (kCheckedIterators) {
+            ptr = pos.Get();
+        }
+        else {
+            ptr = pos;
+        }
+        CheckPolicy::Check(ptr >= Data() && ptr <= DataEnd(), "iterator is out of range");
+        return static_cast<size_t>(ptr - Data());
+    }
+
+    // ,    ,    required 
+    size_t NextCapacity(size_t required) const noexcept {
+        return std::max(required, GrowthPolicy::NextCapacity(GetCapacity(), required, sizeof(Type)));
+    }
+
+    //    [first, last)    dest  storage,    .
+    //  ,         ,  - 
+    static void TransferItems(ArrayPtr<Type, Allocator>& storage, Type* first, Type* last, Type* dest) {
+        if constexpr (std::is_nothrow_move_constructible_v<Type> || !std::is_copy_constructible_v<Type>) {
+            storage.UninitializedCopy(std::make_move_iterator(first), std::make_move_iterator(last), dest);
+        }
+        else {
+            storage.UninitializedCopy(first, last, dest);
+        }
+    }
+
+    //  count      index,      .
+    //       . size_  :   
+    // [index + count, size_ + count),          CloseGap
+    Type* OpenGap(size_t index, size_t count) {
+        const size_t new_size = size_ + count;
+        if (new_size > GetCapacity()) {
+            stats::RecordGrowth<Type>(GetCapacity(), size_);
+        }
+        if constexpr (IsTriviallyRelocatableV<Type>) {
+            if (new_size > GetCapacity()) {
+                items_.Reallocate(NextCapacity(new_size), size_);
+                this->Invalidate();
+            }
+            stats::RecordInsertShift<Type>(size_ - index);
+            std::memmove(static_cast<void*>(Data() + index + count), static_cast<const void*>(Data() + index),
+                (size_ - index) * sizeof(Type));
+        }
+        else if (new_size > GetCapacity()) {
+            ArrayPtr<Type, Allocator> new_vec_(NextCapacity(new_size), items_.GetAllocator());
+            TransferItems(new_vec_, Data(), Data() + index, new_vec_.Get());
+            try {
+                TransferItems(new_vec_, Data() + index, DataEnd(), new_vec_.Get() + index + count);
+            }
+            catch (...) {
+                new_vec_.Destroy(new_vec_.Get(), new_vec_.Get() + index);
+                throw;
+            }
+            items_.Destroy(Data(), DataEnd());
+            items_.swap(new_vec_);
+            this->Invalidate();
+        }
+        else {
+            //      ,   
+            stats::RecordInsertShift<Type>(size_ - index);
+            Type* old_end = DataEnd();
+            const size_t tail = size_ - index;
+            const size_t to_raw = std::min(count, tail);
+            items_.UninitializedCopy(std::make_move_iterator(old_end - to_raw), std::make_move_iterator(old_end),
+                old_end + count - to_raw);
+            std::move_backward(Data() + index, old_end - to_raw, old_end);
+            items_.Destroy(Data() + index, Data() + index + to_raw);
+        }
+        return Data() + index;
+    }
+
+    //     ,    .
+    //     ,       index
+    void CloseGap(size_t index, size_t count) noexcept {
+        Type* gap = Data() + index;
+        if constexpr (IsTriviallyRelocatableV<Type>) {
+            std::memmove(static_cast<void*>(gap), static_cast<const void*>(gap + count), (size_ - index) * sizeof(Type));
+        }
+        else if constexpr (std::is_nothrow_move_constructible_v<Type>) {
+            const size_t to_raw = std::min(count, size_ - index);
+            items_.UninitializedCopy(std::make_move_iterator(gap + count), std::make_move_iterator(gap + count + to_raw), gap);
+            std::move(gap + count + to_raw, DataEnd() + count, gap + to_raw);
+            items_.Destroy(DataEnd() + count - to_raw, DataEnd() + count);
+        }
+        else {
+            items_.Destroy(gap + count, DataEnd() + count);
+            size_ = index;
+        }
+    }
+
+    //    args   index,   
+    template <typename... Args>
+    Type* EmplaceAt(size_t index, Args&&... args) {
+        if constexpr (IsTriviallyRelocatableV<Type>) {
+            return RelocatingEmplaceAt(index, std::forward<Args>(args)...);
+        }
+
+        if (size_ < GetCapacity()) {
+            if (index == size_) {
+                items_.Construct(DataEnd(), std::forward<Args>(args)...);
+            }
+            else {
+                // args       ,     
+                Type tmp(std::forward<Args>(args)...);
+                stats::RecordInsertShift<Type>(size_ - index);
+                items_.Construct(DataEnd(), std::move(*(DataEnd() - 1)));
+                std::move_backward(Data() + index, DataEnd() - 1, DataEnd());
+                items_[index] = std::move(tmp);
+            }
+        }
+        else {
+            //         ,
+            //      
+            stats::RecordGrowth<Type>(GetCapacity(), size_);
+            size_t new_capacity = NextCapacity(size_ + 1);
+            ArrayPtr<Type, Allocator> new_vec_(new_capacity, items_.GetAllocator());
+
+            new_vec_.Construct(new_vec_.Get() + index, std::forward<Args>(args)...);
+            try {
+                TransferItems(new_vec_, Data(), Data() + index, new_vec_.Get());
+            }
+            catch (...) {
+                new_vec_.Destroy(new_vec_.Get() + index, new_vec_.Get() + index + 1);
+                throw;
+            }
+            try {
+                TransferItems(new_vec_, Data() + index, DataEnd(), new_vec_.Get() + index + 1);
+            }
+            catch (...) {
+                new_vec_.Destroy(new_vec_.Get(), new_vec_.Get() + index + 1);
+                throw;
+            }
+            items_.Destroy(Data(), DataEnd());
+
+            items_.swap(new_vec_);
+            this->Invalidate();
+        }
+        size_++;
+        stats::RecordSize<Type>(size_, GetCapacity());
+        return Data() + index;
+    }
+
+    // EmplaceAt    :    Reallocate,    memmove
+    template <typename... Args>
+    Type* RelocatingEmplaceAt(size_t index, Args&&... args) {
+        if (index == size_ && size_ < GetCapacity()) {
+            items_.Construct(DataEnd(), std::forward<Args>(args)...);
+        }
+        else {
+            // args       ,     
+            Type tmp(std::forward<Args>(args)...);
+            if (size_ == GetCapacity()) {
+                stats::RecordGrowth<Type>(GetCapacity(), size_);
+                items_.Reallocate(NextCapacity(size_ + 1), size_);
+                this->Invalidate();
+            }
+            stats::RecordInsertShift<Type>(size_ - index);
+
+            Type* it_pos = Data() + index;
+            const size_t tail_bytes = (size_ - index) * sizeof(Type);
+            std::memmove(static_cast<void*>(it_pos + 1), static_cast<const void*>(it_pos), tail_bytes);
+            try {
+                items_.Construct(it_pos, std::move(tmp));
+            }
+            catch (...) {
+                std::memmove(static_cast<void*>(it_pos), static_cast<const void*>(it_pos + 1), tail_bytes);
+                throw;
+            }
+        }
+        size_++;
+        stats::RecordSize<Type>(size_, GetCapacity());
+        return Data() + index;
+    }
 };
 
-template <typename Type>
-void swap(SimpleVector<Type>& lhs, SimpleVector<Type>& rhs) noexcept {
+// SimpleVector   ,   Alignment  (  -  -)
+template <typename Type, size_t Alignment = 64, typename GrowthPolicy = DoublingGrowth, typename CheckPolicy = AssertPolicy>
+using AlignedSimpleVector = SimpleVector<Type, AlignedAllocator<Type, Alignment>, GrowthPolicy, CheckPolicy>;
+
+namespace pmr {
+
+    // SimpleVector,    std::pmr::memory_resource
+    template <typename Type, typename GrowthPolicy = DoublingGrowth, typename CheckPolicy = AssertPolicy>
+    using SimpleVector = ::SimpleVector<Type, std::pmr::polymorphic_allocator<Type>, GrowthPolicy, CheckPolicy>;
+
+} // namespace pmr
+
+template <typename Type, typename Allocator, typename GrowthPolicy, typename CheckPolicy>
+void swap(SimpleVector<Type, Allocator, GrowthPolicy, CheckPolicy>& lhs, SimpleVector<Type, Allocator, GrowthPolicy, CheckPolicy>& rhs) noexcept {
     lhs.swap(rhs);
 }
 
-template <typename Type>
-inline bool operator==(const SimpleVector<Type>& lhs, const SimpleVector<Type>& rhs) {
-    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+//   ,  pred,   .   
+template <typename Type, typename Allocator, typename GrowthPolicy, typename CheckPolicy, typename Predicate>
+size_t EraseIf(SimpleVector<Type, Allocator, GrowthPolicy, CheckPolicy>& vec, Predicate pred) {
+    auto new_end = std::remove_if(vec.begin(), vec.end(), pred);
+    const size_t removed = vec.end() - new_end;
+    vec.Erase(new_end, vec.end());
+    return removed;
+}
+
+//        simd_kernels.h
+
+template <typename Type, typename Allocator, typename GrowthPolicy, typename CheckPolicy>
+void Fill(SimpleVector<Type, Allocator, GrowthPolicy, CheckPolicy>& vec, const Type& value) {
+    simd::Fill(vec.Data(), vec.Data() + vec.GetSize(), value);
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy, typename CheckPolicy>
+typename SimpleVector<Type, Allocator, GrowthPolicy, CheckPolicy>::ConstIterator Find(const SimpleVector<Type, Allocator, GrowthPolicy, CheckPolicy>& vec, const Type& value) {
+    return vec.begin() + (simd::Find(vec.Data(), vec.Data() + vec.GetSize(), value) - vec.Data());
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy, typename CheckPolicy>
+size_t Count(const SimpleVector<Type, Allocator, GrowthPolicy, CheckPolicy>& vec, const Type& value) {
+    return simd::Count(vec.Data(), vec.Data() + vec.GetSize(), value);
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy, typename CheckPolicy>
+bool Contains(const SimpleVector<Type, Allocator, GrowthPolicy, CheckPolicy>& vec, const Type& value) {
+    return Find(vec, value) != vec.end();
+}
+
+//      
+template <typename Type, typename Allocator, typename GrowthPolicy, typename CheckPolicy>
+std::pair<Type, Type> MinMax(const SimpleVector<Type, Allocator, GrowthPolicy, CheckPolicy>& vec) {
+    assert(!vec.IsEmpty());
+    return simd::MinMax(vec.Data(), vec.Data() + vec.GetSize());
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy, typename CheckPolicy>
+Type Sum(const SimpleVector<Type, Allocator, GrowthPolicy, CheckPolicy>& vec) {
+    return simd::Sum(vec.Data(), vec.Data() + vec.GetSize());
+}
+
+template <typename Type, typename Allocator, typename GrowthPolicy, typename CheckPolicy>
+inline bool operator==(const SimpleVector<Type, Allocator, GrowthPolicy, CheckPolicy>& lhs, const SimpleVector<Type, Allocator, GrowthPolicy, CheckPolicy>& rhs) {
+    return simd::Equal(lhs.Data(), lhs.Data() + lhs.GetSize(), rhs.Data(), rhs.Data() + rhs.GetSize());
 }
 
-template <typename Type>
-inline bool operator!=(const SimpleVector<Type>& lhs, const SimpleVector<Type>& rhs) {
+template <typename Type, typename Allocator, typename GrowthPolicy, typename CheckPolicy>
+inline bool operator!=(const SimpleVector<Type, Allocator, GrowthPolicy, CheckPolicy>& lhs, const SimpleVector<Type, Allocator, GrowthPolicy, CheckPolicy>& rhs) {
     return !(lhs == rhs);
 }
 
-template <typename Type>
-inline bool operator<(const SimpleVector<Type>& lhs, const SimpleVector<Type>& rhs) {
-    return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+template <typename Type, typename Allocator, typename GrowthPolicy, typename CheckPolicy>
+inline bool operator<(const SimpleVector<Type, Allocator, GrowthPolicy, CheckPolicy>& lhs, const SimpleVector<Type, Allocator, GrowthPolicy, CheckPolicy>& rhs) {
+    return simd::LexicographicalLess(lhs.Data(), lhs.Data() + lhs.GetSize(), rhs.Data(), rhs.Data() + rhs.GetSize());
 }
 
 
-template <typename Type>
-inline bool operator<=(const SimpleVector<Type>& lhs, const SimpleVector<Type>& rhs) {
+template <typename Type, typename Allocator, typename GrowthPolicy, typename CheckPolicy>
+inline bool operator<=(const SimpleVector<Type, Allocator, GrowthPolicy, CheckPolicy>& lhs, const SimpleVector<Type, Allocator, GrowthPolicy, CheckPolicy>& rhs) {
     return !(lhs > rhs);
 }
 
-template <typename Type>
-inline bool operator>(const SimpleVector<Type>& lhs, const SimpleVector<Type>& rhs) {
-    return std::lexicographical_compare(rhs.begin(), rhs.end(), lhs.begin(), lhs.end());
+template <typename Type, typename Allocator, typename GrowthPolicy, typename CheckPolicy>
+inline bool operator>(const SimpleVector<Type, Allocator, GrowthPolicy, CheckPolicy>& lhs, const SimpleVector<Type, Allocator, GrowthPolicy, CheckPolicy>& rhs) {
+    return simd::LexicographicalLess(rhs.Data(), rhs.Data() + rhs.GetSize(), lhs.Data(), lhs.Data() + lhs.GetSize());
 }
 
-template <typename Type>
-inline bool operator>=(const SimpleVector<Type>& lhs, const SimpleVector<Type>& rhs) {
+template <typename Type, typename Allocator, typename GrowthPolicy, typename CheckPolicy>
+inline bool operator>=(const SimpleVector<Type, Allocator, GrowthPolicy, CheckPolicy>& lhs, const SimpleVector<Type, Allocator, GrowthPolicy, CheckPolicy>& rhs) {
     return !(lhs < rhs);
 }
\ No newline at end of file
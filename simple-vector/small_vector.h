@@ -0,0 +1,408 @@
+#pragma once
+
+#include <cassert>
+#include <initializer_list>
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "array_ptr.h"
+#include "simple_vector.h"
+
+//    SimpleVector,   N    .
+//  (ArrayPtr)       N,     GrowthPolicy
+template <typename Type, size_t N, typename Allocator = std::allocator<Type>, typename GrowthPolicy = DoublingGrowth>
+class SmallSimpleVector {
+    static_assert(N > 0, "SmallSimpleVector requires a non-empty inline buffer");
+
+public:
+    using Iterator = Type*;
+    using ConstIterator = const Type*;
+
+    SmallSimpleVector() noexcept(noexcept(Allocator())) = default;
+
+    explicit SmallSimpleVector(const Allocator& alloc) noexcept :
+        heap_(alloc) {
+    }
+
+    explicit SmallSimpleVector(size_t size, const Allocator& alloc = Allocator()) :
+        heap_(alloc) {
+        heap_.UninitializedFill(ReserveEmpty(size), size);
+        size_ = size;
+    }
+
+    explicit SmallSimpleVector(ReserveProxyObj obj, const Allocator& alloc = Allocator()) :
+        heap_(alloc) {
+        Reserve(obj.GetVoid());
+    }
+
+    SmallSimpleVector(size_t size, const Type& value, const Allocator& alloc = Allocator()) :
+        heap_(alloc) {
+        heap_.UninitializedFill(ReserveEmpty(size), size, value);
+        size_ = size;
+    }
+
+    SmallSimpleVector(std::initializer_list<Type> init, const Allocator& alloc = Allocator()) :
+        heap_(alloc) {
+        heap_.UninitializedCopy(init.begin(), init.end(), ReserveEmpty(init.size()));
+        size_ = init.size();
+    }
+
+    SmallSimpleVector(const SmallSimpleVector& other) :
+        heap_(std::allocator_traits<Allocator>::select_on_container_copy_construction(other.GetAllocator())) {
+        heap_.UninitializedCopy(other.begin(), other.end(), ReserveEmpty(other.GetSize()));
+        size_ = other.GetSize();
+    }
+
+    //     ,       
+    SmallSimpleVector(SmallSimpleVector&& other) noexcept(std::is_nothrow_move_constructible_v<Type>) :
+        heap_(other.GetAllocator()) {
+        if (other.IsInline()) {
+            heap_.UninitializedCopy(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()), begin());
+            size_ = other.size_;
+            other.Clear();
+        }
+        else {
+            heap_ = std::move(other.heap_);
+            size_ = std::exchange(other.size_, 0);
+        }
+    }
+
+    ~SmallSimpleVector() {
+        heap_.Destroy(begin(), end());
+    }
+
+    SmallSimpleVector& operator=(const SmallSimpleVector& rhs) {
+        if (this != &rhs) {
+            SmallSimpleVector tmp(rhs);
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    SmallSimpleVector& operator=(SmallSimpleVector&& rhs) noexcept(std::is_nothrow_move_constructible_v<Type>) {
+        if (this != &rhs) {
+            SmallSimpleVector tmp(std::move(rhs));
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    Allocator GetAllocator() const noexcept {
+        return heap_.GetAllocator();
+    }
+
+    size_t GetSize() const noexcept {
+        return size_;
+    }
+
+    size_t GetCapacity() const noexcept {
+        return IsInline() ? N : heap_.GetSize();
+    }
+
+    bool IsEmpty() const noexcept {
+        return !size_;
+    }
+
+    //      
+    bool IsInline() const noexcept {
+        return !heap_;
+    }
+
+    Type& operator[](size_t index) noexcept {
+        assert(index < size_);
+        return begin()[index];
+    }
+
+    const Type& operator[](size_t index) const noexcept {
+        assert(index < size_);
+        return begin()[index];
+    }
+
+    Type& At(size_t index) {
+        if (index >= size_) {
+            throw std::out_of_range("Index is Out of Range");
+        }
+        else {
+            return begin()[index];
+        }
+    }
+
+    const Type& At(size_t index) const {
+        if (index >= size_) {
+            throw std::out_of_range("Index is Out of Range");
+        }
+        else {
+            return begin()[index];
+        }
+    }
+
+    void Clear() noexcept {
+        heap_.Destroy(begin(), end());
+        size_ = 0u;
+    }
+
+    void Resize(size_t new_size) {
+        if (new_size == size_) {
+            return;
+        }
+        else if (new_size < size_) {
+            heap_.Destroy(begin() + new_size, end());
+            size_ = new_size;
+        }
+        else {
+            Reserve(new_size);
+            heap_.UninitializedFill(end(), new_size - size_);
+            size_ = new_size;
+        }
+    }
+
+    void Reserve(size_t new_capacity) {
+        if (new_capacity <= GetCapacity()) {
+            return;
+        }
+        else {
+            ArrayPtr<Type, Allocator> new_vec_(new_capacity, heap_.GetAllocator());
+            TransferItems(new_vec_, begin(), end(), new_vec_.Get());
+            DestroyTransferred();
+            heap_ = std::move(new_vec_);
+        }
+    }
+
+    Iterator begin() noexcept {
+        return IsInline() ? reinterpret_cast<Type*>(inline_) : heap_.Get();
+    }
+
+    Iterator end() noexcept {
+        return begin() + size_;
+    }
+
+    ConstIterator begin() const noexcept {
+        return IsInline() ? reinterpret_cast<const Type*>(inline_) : heap_.Get();
+    }
+
+    ConstIterator end() const noexcept {
+        return begin() + size_;
+    }
+
+    ConstIterator cbegin() const noexcept {
+        return begin();
+    }
+
+    ConstIterator cend() const noexcept {
+        return end();
+    }
+
+    //  Push_Back
+    void PushBack(const Type& item) {
+        EmplaceAt(size_, item);
+    }
+
+    //  Push_Back
+    void PushBack(Type&& item) {
+        EmplaceAt(size_, std::move(item));
+    }
+
+    //    args    
+    template <typename... Args>
+    Type& EmplaceBack(Args&&... args) {
+        return *EmplaceAt(size_, std::forward<Args>(args)...);
+    }
+
+    //    args    pos
+    template <typename... Args>
+    Iterator Emplace(ConstIterator pos, Args&&... args) {
+
+        assert(pos >= cbegin());
+        assert(pos <= cend());
+
+        return EmplaceAt(pos - cbegin(), std::forward<Args>(args)...);
+    }
+
+    Iterator Insert(ConstIterator pos, const Type& value) {
+
+        assert(pos >= cbegin());
+        assert(pos <= cend());
+
+        return EmplaceAt(pos - cbegin(), value);
+    }
+
+    //  Insert
+    Iterator Insert(ConstIterator pos, Type&& value) {
+
+        assert(pos >= cbegin());
+        assert(pos <= cend());
+
+        return EmplaceAt(pos - cbegin(), std::move(value));
+    }
+
+    void PopBack() noexcept {
+        assert(!IsEmpty());
+        heap_.Destroy(end() - 1, end());
+        size_--;
+    }
+
+    //      
+    Iterator Erase(ConstIterator pos) {
+
+        assert(pos >= cbegin());
+        assert(pos < cend());
+        assert(!IsEmpty());
+
+        Iterator it_pos = begin() + (pos - cbegin());
+
+        std::move((it_pos + 1), end(), it_pos);
+        PopBack();
+
+        return it_pos;
+    }
+
+    void swap(SmallSimpleVector& other) noexcept(std::is_nothrow_move_constructible_v<Type>) {
+        if (!IsInline() && !other.IsInline()) {
+            std::swap(size_, other.size_);
+            heap_.swap(other.heap_);
+        }
+        else {
+            SmallSimpleVector tmp(std::move(other));
+            other.MoveFrom(*this);
+            MoveFrom(tmp);
+        }
+    }
+
+private:
+    size_t size_ = 0u;
+
+    // ,      
+    ArrayPtr<Type, Allocator> heap_;
+
+    alignas(Type) unsigned char inline_[N * sizeof(Type)];
+
+    //   capacity     :       .
+    //      ,      
+    Type* ReserveEmpty(size_t capacity) {
+        assert(IsEmpty() && IsInline());
+        if (capacity <= N) {
+            return reinterpret_cast<Type*>(inline_);
+        }
+        heap_ = ArrayPtr<Type, Allocator>(capacity, heap_.GetAllocator());
+        return heap_.Get();
+    }
+
+    size_t NextCapacity(size_t required) const noexcept {
+        return std::max(required, GrowthPolicy::NextCapacity(GetCapacity(), required, sizeof(Type)));
+    }
+
+    //    [first, last)    dest,    
+    static void TransferItems(ArrayPtr<Type, Allocator>& storage, Iterator first, Iterator last, Iterator dest) {
+        if constexpr (IsTriviallyRelocatableV<Type>) {
+            if (first != last) {
+                std::memcpy(static_cast<void*>(dest), static_cast<const void*>(first), (last - first) * sizeof(Type));
+            }
+        }
+        else if constexpr (std::is_nothrow_move_constructible_v<Type> || !std::is_copy_constructible_v<Type>) {
+            storage.UninitializedCopy(std::make_move_iterator(first), std::make_move_iterator(last), dest);
+        }
+        else {
+            storage.UninitializedCopy(first, last, dest);
+        }
+    }
+
+    //  :   ,      
+    void DestroyTransferred() noexcept {
+        if constexpr (!IsTriviallyRelocatableV<Type>) {
+            heap_.Destroy(begin(), end());
+        }
+    }
+
+    //      other,  other 
+    void MoveFrom(SmallSimpleVector& other) {
+        Clear();
+        if (other.IsInline()) {
+            heap_ = ArrayPtr<Type, Allocator>(heap_.GetAllocator());
+            heap_.UninitializedCopy(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()), begin());
+            size_ = other.size_;
+            other.Clear();
+        }
+        else {
+            heap_ = std::move(other.heap_);
+            size_ = std::exchange(other.size_, 0);
+        }
+    }
+
+    //    args   index,   
+    template <typename... Args>
+    Iterator EmplaceAt(size_t index, Args&&... args) {
+        if (size_ < GetCapacity()) {
+            if (index == size_) {
+                heap_.Construct(end(), std::forward<Args>(args)...);
+            }
+            else {
+                // args       ,     
+                Type tmp(std::forward<Args>(args)...);
+                heap_.Construct(end(), std::move(*(end() - 1)));
+                std::move_backward(begin() + index, end() - 1, end());
+                begin()[index] = std::move(tmp);
+            }
+        }
+        else {
+            ArrayPtr<Type, Allocator> new_vec_(NextCapacity(size_ + 1), heap_.GetAllocator());
+
+            new_vec_.Construct(new_vec_.Get() + index, std::forward<Args>(args)...);
+            try {
+                TransferItems(new_vec_, begin(), begin() + index, new_vec_.Get());
+            }
+            catch (...) {
+                new_vec_.Destroy(new_vec_.Get() + index, new_vec_.Get() + index + 1);
+                throw;
+            }
+            try {
+                TransferItems(new_vec_, begin() + index, end(), new_vec_.Get() + index + 1);
+            }
+            catch (...) {
+                new_vec_.Destroy(new_vec_.Get(), new_vec_.Get() + index + 1);
+                throw;
+            }
+            DestroyTransferred();
+            heap_ = std::move(new_vec_);
+        }
+        size_++;
+        return begin() + index;
+    }
+};
+
+template <typename Type, size_t N, typename Allocator, typename GrowthPolicy>
+void swap(SmallSimpleVector<Type, N, Allocator, GrowthPolicy>& lhs, SmallSimpleVector<Type, N, Allocator, GrowthPolicy>& rhs) noexcept(noexcept(lhs.swap(rhs))) {
+    lhs.swap(rhs);
+}
+
+template <typename Type, size_t N, typename Allocator, typename GrowthPolicy>
+inline bool operator==(const SmallSimpleVector<Type, N, Allocator, GrowthPolicy>& lhs, const SmallSimpleVector<Type, N, Allocator, GrowthPolicy>& rhs) {
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename Type, size_t N, typename Allocator, typename GrowthPolicy>
+inline bool operator!=(const SmallSimpleVector<Type, N, Allocator, GrowthPolicy>& lhs, const SmallSimpleVector<Type, N, Allocator, GrowthPolicy>& rhs) {
+    return !(lhs == rhs);
+}
+
+template <typename Type, size_t N, typename Allocator, typename GrowthPolicy>
+inline bool operator<(const SmallSimpleVector<Type, N, Allocator, GrowthPolicy>& lhs, const SmallSimpleVector<Type, N, Allocator, GrowthPolicy>& rhs) {
+    return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename Type, size_t N, typename Allocator, typename GrowthPolicy>
+inline bool operator<=(const SmallSimpleVector<Type, N, Allocator, GrowthPolicy>& lhs, const SmallSimpleVector<Type, N, Allocator, GrowthPolicy>& rhs) {
+    return !(lhs > rhs);
+}
+
+template <typename Type, size_t N, typename Allocator, typename GrowthPolicy>
+inline bool operator>(const SmallSimpleVector<Type, N, Allocator, GrowthPolicy>& lhs, const SmallSimpleVector<Type, N, Allocator, GrowthPolicy>& rhs) {
+    return std::lexicographical_compare(rhs.begin(), rhs.end(), lhs.begin(), lhs.end());
+}
+
+template <typename Type, size_t N, typename Allocator, typename GrowthPolicy>
+inline bool operator>=(const SmallSimpleVector<Type, N, Allocator, GrowthPolicy>& lhs, const SmallSimpleVector<Type, N, Allocator, GrowthPolicy>& rhs) {
+    return !(lhs < rhs);
+}
@@ -0,0 +1,467 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "array_ptr.h"
+#include "growth_policy.h"
+
+//     SoaVector.    
+template <typename Type>
+class ColumnSpan {
+public:
+    ColumnSpan() = default;
+
+    ColumnSpan(Type* data, size_t size) noexcept
+        : data_(data), size_(size) {
+    }
+
+    Type* Data() const noexcept {
+        return data_;
+    }
+
+    size_t GetSize() const noexcept {
+        return size_;
+    }
+
+    bool IsEmpty() const noexcept {
+        return !size_;
+    }
+
+    Type& operator[](size_t index) const noexcept {
+        assert(index < size_);
+        return data_[index];
+    }
+
+    Type* begin() const noexcept {
+        return data_;
+    }
+
+    Type* end() const noexcept {
+        return data_ + size_;
+    }
+
+private:
+    Type* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+//  ,       (structure of arrays).   
+//     ,       ,    .
+//          :    
+//     ,       
+template <typename... Ts>
+class SoaVector {
+    static_assert(sizeof...(Ts) > 0, "SoaVector requires at least one column");
+
+    using Columns = std::tuple<ArrayPtr<Ts>...>;
+    using Indices = std::index_sequence_for<Ts...>;
+
+    //      ,   
+    static constexpr size_t kRowSize = (sizeof(Ts) + ...);
+
+    template <bool IsConst>
+    class BasicIterator;
+
+public:
+    template <size_t I>
+    using ColumnType = std::tuple_element_t<I, std::tuple<Ts...>>;
+
+    //   -      ,   
+    using RowReference = std::tuple<Ts&...>;
+    using ConstRowReference = std::tuple<const Ts&...>;
+
+    using Iterator = BasicIterator<false>;
+    using ConstIterator = BasicIterator<true>;
+
+    SoaVector() noexcept = default;
+
+    explicit SoaVector(size_t size) {
+        Resize(size);
+    }
+
+    SoaVector(const SoaVector& other) {
+        Reserve(other.size_);
+        for (size_t i = 0; i < other.size_; ++i) {
+            std::apply([this](const Ts&... values) { PushBack(values...); }, other.Row(i));
+        }
+    }
+
+    SoaVector(SoaVector&& other) noexcept
+        : columns_(std::move(other.columns_)),
+          size_(std::exchange(other.size_, 0)),
+          capacity_(std::exchange(other.capacity_, 0)) {
+    }
+
+    ~SoaVector() {
+        DestroyRows(0, size_, Indices{});
+    }
+
+    SoaVector& operator=(const SoaVector& rhs) {
+        if (this != &rhs) {
+            SoaVector tmp(rhs);
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    SoaVector& operator=(SoaVector&& rhs) noexcept {
+        if (this != &rhs) {
+            SoaVector tmp(std::move(rhs));
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    size_t GetSize() const noexcept {
+        return size_;
+    }
+
+    size_t GetCapacity() const noexcept {
+        return capacity_;
+    }
+
+    bool IsEmpty() const noexcept {
+        return !size_;
+    }
+
+    RowReference operator[](size_t index) noexcept {
+        assert(index < size_);
+        return Row(index);
+    }
+
+    ConstRowReference operator[](size_t index) const noexcept {
+        assert(index < size_);
+        return Row(index);
+    }
+
+    RowReference At(size_t index) {
+        if (index >= size_) {
+            throw std::out_of_range("Index is Out of Range");
+        }
+        return Row(index);
+    }
+
+    ConstRowReference At(size_t index) const {
+        if (index >= size_) {
+            throw std::out_of_range("Index is Out of Range");
+        }
+        return Row(index);
+    }
+
+    //  I :    GetSize() 
+    template <size_t I>
+    ColumnSpan<ColumnType<I>> Column() noexcept {
+        return { std::get<I>(columns_).Get(), size_ };
+    }
+
+    template <size_t I>
+    ColumnSpan<const ColumnType<I>> Column() const noexcept {
+        return { std::get<I>(columns_).Get(), size_ };
+    }
+
+    //  ,  I   values[I]
+    template <typename... Args>
+    void PushBack(Args&&... values) {
+        static_assert(sizeof...(Args) == sizeof...(Ts), "PushBack takes one value per column");
+        if (size_ < capacity_) {
+            ConstructRow(columns_, Indices{}, std::forward<Args>(values)...);
+        }
+        else {
+            //       ,   
+            //       
+            const size_t new_capacity = DoublingGrowth::NextCapacity(capacity_, size_ + 1, kRowSize);
+            Columns new_columns{ ArrayPtr<Ts>(new_capacity)... };
+            ConstructRow(new_columns, Indices{}, std::forward<Args>(values)...);
+            try {
+                TransferRows(new_columns, Indices{});
+            }
+            catch (...) {
+                RollbackRows(new_columns, size_, size_ + 1, sizeof...(Ts), Indices{});
+                throw;
+            }
+            Adopt(new_columns, new_capacity);
+        }
+        ++size_;
+    }
+
+    void PopBack() noexcept {
+        assert(!IsEmpty());
+        DestroyRows(size_ - 1, size_, Indices{});
+        --size_;
+    }
+
+    void Clear() noexcept {
+        DestroyRows(0, size_, Indices{});
+        size_ = 0;
+    }
+
+    //    ,  -      
+    void Resize(size_t new_size) {
+        if (new_size <= size_) {
+            DestroyRows(new_size, size_, Indices{});
+        }
+        else {
+            Reserve(new_size);
+            FillRows(new_size - size_, Indices{});
+        }
+        size_ = new_size;
+    }
+
+    //      
+    void Reserve(size_t new_capacity) {
+        if (new_capacity <= capacity_) {
+            return;
+        }
+        Columns new_columns{ ArrayPtr<Ts>(new_capacity)... };
+        TransferRows(new_columns, Indices{});
+        Adopt(new_columns, new_capacity);
+    }
+
+    Iterator begin() noexcept {
+        return Iterator(this, 0);
+    }
+
+    Iterator end() noexcept {
+        return Iterator(this, size_);
+    }
+
+    ConstIterator begin() const noexcept {
+        return ConstIterator(this, 0);
+    }
+
+    ConstIterator end() const noexcept {
+        return ConstIterator(this, size_);
+    }
+
+    ConstIterator cbegin() const noexcept {
+        return begin();
+    }
+
+    ConstIterator cend() const noexcept {
+        return end();
+    }
+
+    void swap(SoaVector& other) noexcept {
+        std::swap(columns_, other.columns_);
+        std::swap(size_, other.size_);
+        std::swap(capacity_, other.capacity_);
+    }
+
+private:
+    Columns columns_;
+    size_t size_ = 0;
+    size_t capacity_ = 0;
+
+    RowReference Row(size_t index) noexcept {
+        return std::apply([index](ArrayPtr<Ts>&... columns) { return RowReference(columns[index]...); }, columns_);
+    }
+
+    ConstRowReference Row(size_t index) const noexcept {
+        return std::apply([index](const ArrayPtr<Ts>&... columns) { return ConstRowReference(columns[index]...); }, columns_);
+    }
+
+    template <size_t... Is>
+    void DestroyRows(size_t first, size_t last, std::index_sequence<Is...>) noexcept {
+        (std::get<Is>(columns_).Destroy(std::get<Is>(columns_).Get() + first, std::get<Is>(columns_).Get() + last), ...);
+    }
+
+    //  :    ,   
+    template <size_t... Is>
+    void DestroyTransferred(std::index_sequence<Is...>) noexcept {
+        ((IsTriviallyRelocatableV<ColumnType<Is>> ? void()
+            : std::get<Is>(columns_).Destroy(std::get<Is>(columns_).Get(), std::get<Is>(columns_).Get() + size_)), ...);
+    }
+
+    //   ,      
+    void Adopt(Columns& new_columns, size_t new_capacity) noexcept {
+        DestroyTransferred(Indices{});
+        columns_ = std::move(new_columns);
+        capacity_ = new_capacity;
+    }
+
+    //   [first, last)   done  -  ,  
+    template <size_t... Is>
+    void RollbackRows(Columns& columns, size_t first, size_t last, size_t done, std::index_sequence<Is...>) noexcept {
+        ((Is < done ? std::get<Is>(columns).Destroy(std::get<Is>(columns).Get() + first, std::get<Is>(columns).Get() + last)
+                    : void()), ...);
+    }
+
+    template <size_t... Is, typename... Args>
+    void ConstructRow(Columns& columns, std::index_sequence<Is...>, Args&&... values) {
+        size_t done = 0;
+        try {
+            ((std::get<Is>(columns).Construct(std::get<Is>(columns).Get() + size_, std::forward<Args>(values)), ++done), ...);
+        }
+        catch (...) {
+            RollbackRows(columns, size_, size_ + 1, done, Indices{});
+            throw;
+        }
+    }
+
+    template <size_t... Is>
+    void FillRows(size_t count, std::index_sequence<Is...>) {
+        size_t done = 0;
+        try {
+            ((std::get<Is>(columns_).UninitializedFill(std::get<Is>(columns_).Get() + size_, count), ++done), ...);
+        }
+        catch (...) {
+            RollbackRows(columns_, size_, size_ + count, done, Indices{});
+            throw;
+        }
+    }
+
+    //      :    -  memcpy,
+    //  - ,     ,  
+    template <size_t I>
+    void TransferColumn(ArrayPtr<ColumnType<I>>& dest) {
+        using Type = ColumnType<I>;
+        ArrayPtr<Type>& source = std::get<I>(columns_);
+        if constexpr (IsTriviallyRelocatableV<Type>) {
+            if (size_ != 0) {
+                std::memcpy(static_cast<void*>(dest.Get()), static_cast<const void*>(source.Get()), size_ * sizeof(Type));
+            }
+        }
+        else if constexpr (std::is_nothrow_move_constructible_v<Type> || !std::is_copy_constructible_v<Type>) {
+            dest.UninitializedCopy(std::make_move_iterator(source.Get()), std::make_move_iterator(source.Get() + size_), dest.Get());
+        }
+        else {
+            dest.UninitializedCopy(source.Get(), source.Get() + size_, dest.Get());
+        }
+    }
+
+    template <size_t... Is>
+    void TransferRows(Columns& dest, std::index_sequence<Is...>) {
+        size_t done = 0;
+        try {
+            ((TransferColumn<Is>(std::get<Is>(dest)), ++done), ...);
+        }
+        catch (...) {
+            RollbackRows(dest, 0, size_, done, Indices{});
+            throw;
+        }
+    }
+
+    //   :       
+    template <bool IsConst>
+    class BasicIterator {
+        using Owner = std::conditional_t<IsConst, const SoaVector, SoaVector>;
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = std::tuple<Ts...>;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::conditional_t<IsConst, ConstRowReference, RowReference>;
+        using pointer = void;
+
+        BasicIterator() = default;
+
+        //      
+        template <bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+        BasicIterator(const BasicIterator<OtherConst>& other) noexcept
+            : owner_(other.owner_), index_(other.index_) {
+        }
+
+        reference operator*() const noexcept {
+            return owner_->Row(index_);
+        }
+
+        reference operator[](difference_type offset) const noexcept {
+            return owner_->Row(index_ + offset);
+        }
+
+        BasicIterator& operator++() noexcept {
+            ++index_;
+            return *this;
+        }
+
+        BasicIterator operator++(int) noexcept {
+            BasicIterator old = *this;
+            ++index_;
+            return old;
+        }
+
+        BasicIterator& operator--() noexcept {
+            --index_;
+            return *this;
+        }
+
+        BasicIterator operator--(int) noexcept {
+            BasicIterator old = *this;
+            --index_;
+            return old;
+        }
+
+        BasicIterator& operator+=(difference_type offset) noexcept {
+            index_ += offset;
+            return *this;
+        }
+
+        BasicIterator& operator-=(difference_type offset) noexcept {
+            index_ -= offset;
+            return *this;
+        }
+
+        friend BasicIterator operator+(BasicIterator it, difference_type offset) noexcept {
+            return it += offset;
+        }
+
+        friend BasicIterator operator+(difference_type offset, BasicIterator it) noexcept {
+            return it += offset;
+        }
+
+        friend BasicIterator operator-(BasicIterator it, difference_type offset) noexcept {
+            return it -= offset;
+        }
+
+        friend difference_type operator-(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return static_cast<difference_type>(lhs.index_) - static_cast<difference_type>(rhs.index_);
+        }
+
+        friend bool operator==(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return lhs.index_ == rhs.index_;
+        }
+
+        friend bool operator!=(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return lhs.index_ != rhs.index_;
+        }
+
+        friend bool operator<(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return lhs.index_ < rhs.index_;
+        }
+
+        friend bool operator>(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return rhs < lhs;
+        }
+
+        friend bool operator<=(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return !(rhs < lhs);
+        }
+
+        friend bool operator>=(const BasicIterator& lhs, const BasicIterator& rhs) noexcept {
+            return !(lhs < rhs);
+        }
+
+    private:
+        friend class SoaVector;
+        friend class BasicIterator<!IsConst>;
+
+        BasicIterator(Owner* owner, size_t index) noexcept
+            : owner_(owner), index_(index) {
+        }
+
+        Owner* owner_ = nullptr;
+        size_t index_ = 0;
+    };
+};
+
+template <typename... Ts>
+void swap(SoaVector<Ts...>& lhs, SoaVector<Ts...>& rhs) noexcept {
+    lhs.swap(rhs);
+}
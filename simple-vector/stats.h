@@ -0,0 +1,221 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <typeinfo>
+
+//   : ,   ,  ,
+//     ,    .   SIMPLE_VECTOR_STATS,
+//    .    Record*     ,
+//          
+namespace stats {
+
+#ifdef SIMPLE_VECTOR_STATS
+    inline constexpr bool kEnabled = true;
+#else
+    inline constexpr bool kEnabled = false;
+#endif
+
+    //         
+    struct Counters {
+        std::atomic<size_t> allocations{ 0 };
+        std::atomic<size_t> bytes_allocated{ 0 };
+        //     (Reserve, PushBack, Insert)
+        std::atomic<size_t> reallocations{ 0 };
+        // ,      
+        std::atomic<size_t> moved_by_growth{ 0 };
+        // ,    
+        std::atomic<size_t> insert_shifted{ 0 };
+        std::atomic<size_t> erase_shifted{ 0 };
+        //      
+        std::atomic<size_t> peak_capacity{ 0 };
+        std::atomic<size_t> peak_size{ 0 };
+
+        void Reset() noexcept {
+            for (std::atomic<size_t>* counter : { &allocations, &bytes_allocated, &reallocations, &moved_by_growth,
+                                                  &insert_shifted, &erase_shifted, &peak_capacity, &peak_size }) {
+                counter->store(0, std::memory_order_relaxed);
+            }
+        }
+    };
+
+    enum class EventKind {
+        ALLOCATION,
+        REALLOCATION,
+        INSERT_SHIFT,
+        ERASE_SHIFT
+    };
+
+    //     . value -   ALLOCATION,    
+    struct Event {
+        EventKind kind;
+        const std::type_info& type;
+        size_t value;
+    };
+
+    using Callback = void (*)(const Event&);
+
+    //  ,       
+    struct TypeCounters {
+        explicit TypeCounters(const std::type_info& counted_type) noexcept
+            : type(counted_type) {
+        }
+
+        const std::type_info& type;
+        Counters counters;
+        TypeCounters* next = nullptr;
+    };
+
+#ifdef SIMPLE_VECTOR_STATS
+
+    namespace detail {
+
+        inline std::atomic<Callback> callback{ nullptr };
+        inline std::atomic<TypeCounters*> registry{ nullptr };
+
+        inline void Add(std::atomic<size_t>& counter, size_t value) noexcept {
+            counter.fetch_add(value, std::memory_order_relaxed);
+        }
+
+        inline void Max(std::atomic<size_t>& counter, size_t value) noexcept {
+            size_t current = counter.load(std::memory_order_relaxed);
+            while (current < value && !counter.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+            }
+        }
+
+        template <typename Type>
+        TypeCounters& Register() noexcept {
+            static TypeCounters* node = [] {
+                static TypeCounters counters(typeid(Type));
+                counters.next = registry.load(std::memory_order_relaxed);
+                while (!registry.compare_exchange_weak(counters.next, &counters, std::memory_order_release)) {
+                }
+                return &counters;
+            }();
+            return *node;
+        }
+
+    } // namespace detail
+
+    inline Counters& Global() noexcept {
+        static Counters counters;
+        return counters;
+    }
+
+    template <typename Type>
+    Counters& ForType() noexcept {
+        return detail::Register<Type>().counters;
+    }
+
+    //    ,      
+    template <typename Function>
+    void ForEachType(Function func) {
+        for (TypeCounters* node = detail::registry.load(std::memory_order_acquire); node; node = node->next) {
+            func(node->type, static_cast<const Counters&>(node->counters));
+        }
+    }
+
+    //      , nullptr  
+    inline void SetCallback(Callback callback) noexcept {
+        detail::callback.store(callback, std::memory_order_release);
+    }
+
+    namespace detail {
+
+        template <typename Type>
+        void Record(std::atomic<size_t> Counters::* counter, EventKind kind, size_t value) noexcept {
+            Add(Global().*counter, value);
+            Add(ForType<Type>().*counter, value);
+            if (Callback handler = callback.load(std::memory_order_acquire)) {
+                handler(Event{ kind, typeid(Type), value });
+            }
+        }
+
+    } // namespace detail
+
+    template <typename Type>
+    void RecordAllocation(size_t bytes) noexcept {
+        detail::Add(Global().allocations, 1);
+        detail::Add(ForType<Type>().allocations, 1);
+        detail::Record<Type>(&Counters::bytes_allocated, EventKind::ALLOCATION, bytes);
+    }
+
+    //    old_capacity   moved .      
+    template <typename Type>
+    void RecordGrowth(size_t old_capacity, size_t moved) noexcept {
+        if (old_capacity == 0) {
+            return;
+        }
+        detail::Add(Global().reallocations, 1);
+        detail::Add(ForType<Type>().reallocations, 1);
+        detail::Record<Type>(&Counters::moved_by_growth, EventKind::REALLOCATION, moved);
+    }
+
+    template <typename Type>
+    void RecordInsertShift(size_t count) noexcept {
+        if (count != 0) {
+            detail::Record<Type>(&Counters::insert_shifted, EventKind::INSERT_SHIFT, count);
+        }
+    }
+
+    template <typename Type>
+    void RecordEraseShift(size_t count) noexcept {
+        if (count != 0) {
+            detail::Record<Type>(&Counters::erase_shifted, EventKind::ERASE_SHIFT, count);
+        }
+    }
+
+    template <typename Type>
+    void RecordSize(size_t size, size_t capacity) noexcept {
+        Counters& counters = ForType<Type>();
+        detail::Max(counters.peak_size, size);
+        detail::Max(counters.peak_capacity, capacity);
+        detail::Max(Global().peak_size, size);
+        detail::Max(Global().peak_capacity, capacity);
+    }
+
+#else
+
+    //     ,    
+
+    inline Counters& Global() noexcept {
+        static Counters counters;
+        return counters;
+    }
+
+    template <typename Type>
+    Counters& ForType() noexcept {
+        static Counters counters;
+        return counters;
+    }
+
+    template <typename Function>
+    void ForEachType(Function) {
+    }
+
+    inline void SetCallback(Callback) noexcept {
+    }
+
+    template <typename Type>
+    inline void RecordAllocation(size_t) noexcept {
+    }
+
+    template <typename Type>
+    inline void RecordGrowth(size_t, size_t) noexcept {
+    }
+
+    template <typename Type>
+    inline void RecordInsertShift(size_t) noexcept {
+    }
+
+    template <typename Type>
+    inline void RecordEraseShift(size_t) noexcept {
+    }
+
+    template <typename Type>
+    inline void RecordSize(size_t, size_t) noexcept {
+    }
+
+#endif
+
+} // namespace stats